@@ -0,0 +1,151 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <rexsapi/Value.hxx>
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+namespace
+{
+  using TValues = std::vector<std::pair<rexsapi::TValueType, rexsapi::TValue>>;
+
+  TValues createValues(size_t count)
+  {
+    TValues values;
+    values.reserve(count);
+    for (size_t n = 0; n < count; ++n) {
+      switch (n % 4) {
+        case 0:
+          values.emplace_back(rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{static_cast<double>(n)});
+          break;
+        case 1:
+          values.emplace_back(rexsapi::TValueType::INTEGER, rexsapi::TValue{static_cast<int64_t>(n)});
+          break;
+        case 2:
+          values.emplace_back(rexsapi::TValueType::STRING, rexsapi::TValue{std::string{"gear"}});
+          break;
+        default:
+          values.emplace_back(rexsapi::TValueType::FLOATING_POINT_ARRAY, rexsapi::TValue{std::vector<double>{1.0, 2.0}});
+          break;
+      }
+    }
+    return values;
+  }
+
+  size_t dispatchValue(rexsapi::TValueType type, const rexsapi::TValue& value)
+  {
+    return rexsapi::dispatch<size_t>(type, value,
+                                     {[](rexsapi::FloatTag, const auto& d) -> size_t {
+                                        return static_cast<size_t>(d);
+                                      },
+                                      [](rexsapi::BoolTag, const auto& b) -> size_t {
+                                        return b ? 1 : 0;
+                                      },
+                                      [](rexsapi::IntTag, const auto& i) -> size_t {
+                                        return static_cast<size_t>(i);
+                                      },
+                                      [](rexsapi::EnumTag, const auto& s) -> size_t {
+                                        return s.size();
+                                      },
+                                      [](rexsapi::StringTag, const auto& s) -> size_t {
+                                        return s.size();
+                                      },
+                                      [](rexsapi::FileReferenceTag, const auto& s) -> size_t {
+                                        return s.size();
+                                      },
+                                      [](rexsapi::FloatArrayTag, const auto& a) -> size_t {
+                                        return a.size();
+                                      },
+                                      [](rexsapi::BoolArrayTag, const auto& a) -> size_t {
+                                        return a.size();
+                                      },
+                                      [](rexsapi::IntArrayTag, const auto& a) -> size_t {
+                                        return a.size();
+                                      },
+                                      [](rexsapi::EnumArrayTag, const auto& a) -> size_t {
+                                        return a.size();
+                                      },
+                                      [](rexsapi::StringArrayTag, const auto& a) -> size_t {
+                                        return a.size();
+                                      },
+                                      [](rexsapi::ReferenceComponentTag, const auto& n) -> size_t {
+                                        return static_cast<size_t>(n);
+                                      },
+                                      [](rexsapi::FloatMatrixTag, const auto& m) -> size_t {
+                                        return m.m_Values.size();
+                                      },
+                                      [](rexsapi::StringMatrixTag, const auto& m) -> size_t {
+                                        return m.m_Values.size();
+                                      },
+                                      [](rexsapi::ArrayOfIntArraysTag, const auto& a) -> size_t {
+                                        return a.size();
+                                      }});
+  }
+
+  size_t visitValue(rexsapi::TValueType type, const rexsapi::TValue& value)
+  {
+    return rexsapi::visit<size_t>(
+      type, value,
+      [](rexsapi::FloatTag, const auto& d) -> size_t {
+        return static_cast<size_t>(d);
+      },
+      [](rexsapi::BoolTag, const auto& b) -> size_t {
+        return b ? 1 : 0;
+      },
+      [](rexsapi::IntTag, const auto& i) -> size_t {
+        return static_cast<size_t>(i);
+      },
+      [](rexsapi::ReferenceComponentTag, const auto& n) -> size_t {
+        return static_cast<size_t>(n);
+      },
+      [](auto, const auto& a) -> decltype(a.size()) {
+        return a.size();
+      },
+      [](rexsapi::FloatMatrixTag, const auto& m) -> size_t {
+        return m.m_Values.size();
+      },
+      [](rexsapi::StringMatrixTag, const auto& m) -> size_t {
+        return m.m_Values.size();
+      });
+  }
+
+  template<typename TFunc>
+  void run(ankerl::nanobench::Bench& bench, std::string_view name, const TValues& values, TFunc&& func)
+  {
+    bench.run(std::string{name}, [&values, &func] {
+      size_t checksum = 0;
+      for (const auto& [type, value] : values) {
+        checksum += func(type, value);
+      }
+      ankerl::nanobench::doNotOptimizeAway(checksum);
+    });
+  }
+}
+
+
+int main(int, char**)
+{
+  const auto values = createValues(10000);
+
+  ankerl::nanobench::Bench bench;
+  bench.title("dispatch").batch(values.size()).unit("attribute").performanceCounters(false);
+  run(bench, "dispatch", values, dispatchValue);
+  run(bench, "visit", values, visitValue);
+
+  return 0;
+}
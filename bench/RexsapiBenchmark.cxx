@@ -0,0 +1,276 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define REXSAPI_MINIZ_IMPL
+#include <rexsapi/ModelGenerator.hxx>
+#include <rexsapi/Rexsapi.hxx>
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include "BenchHelper.hxx"
+
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+
+namespace
+{
+  struct TBenchModel {
+    std::string m_Name;
+    std::filesystem::path m_Xml;
+    std::filesystem::path m_Json;
+    std::filesystem::path m_Zip;
+  };
+
+  size_t countAttributes(const rexsapi::TModel& model)
+  {
+    size_t count = 0;
+    for (const auto& component : model.getComponents()) {
+      count += component.getAttributes().size();
+    }
+    return count;
+  }
+
+  rexsapi::TModel loadModel(const rexsapi::TModelLoader& loader, const std::filesystem::path& path)
+  {
+    rexsapi::TResult result;
+    auto model = loader.load(path, result);
+    if (!result || !model) {
+      throw std::runtime_error{fmt::format("cannot load model {}", path.string())};
+    }
+    return std::move(*model);
+  }
+
+  rexsapi::json loadJson(const std::filesystem::path& path)
+  {
+    std::ifstream stream{path};
+    return rexsapi::json::parse(stream);
+  }
+
+  rexsapi::database::TModelRegistry createRegistry(const std::filesystem::path& databasePath,
+                                                   rexsapi::database::TLoadMode mode)
+  {
+    const rexsapi::xml::TFileXsdSchemaLoader schemaLoader{databasePath / "rexs-dbmodel.xsd"};
+    const rexsapi::database::TFileResourceLoader resourceLoader{databasePath, mode};
+    const rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+    auto [registry, result] = rexsapi::database::TModelRegistry::createModelRegistry(modelLoader);
+    if (!result) {
+      throw std::runtime_error{"cannot load database models"};
+    }
+    return std::move(registry);
+  }
+
+  void benchmarkRegistry(ankerl::nanobench::Bench& bench, const std::filesystem::path& databasePath)
+  {
+    bench.batch(1).unit("registry");
+    for (const auto mode : {rexsapi::database::TLoadMode::SEQUENTIAL, rexsapi::database::TLoadMode::PARALLEL}) {
+      const auto name = mode == rexsapi::database::TLoadMode::SEQUENTIAL ? "sequential" : "parallel";
+      bench.run(fmt::format("registry {}", name), [&databasePath, mode] {
+        ankerl::nanobench::doNotOptimizeAway(createRegistry(databasePath, mode).getModel({1, 4}, "en").getDate());
+      });
+    }
+  }
+
+  std::string getName(const rexsapi::TModelGeneratorOptions& options)
+  {
+    return fmt::format("synthetic_{}x{}", options.m_Components, options.m_AttributesPerComponent);
+  }
+
+  void benchmarkBuilder(ankerl::nanobench::Bench& bench, const rexsapi::TModelGenerator& generator,
+                        const rexsapi::TModelGeneratorOptions& options)
+  {
+    bench.batch(options.m_Components * options.m_AttributesPerComponent).unit("attribute");
+    bench.run(fmt::format("build {}", getName(options)), [&generator] {
+      ankerl::nanobench::doNotOptimizeAway(generator.generate().getComponents().size());
+    });
+  }
+
+  void benchmarkModel(ankerl::nanobench::Bench& bench, const rexsapi::TModelLoader& loader,
+                      const std::filesystem::path& databasePath, const TBenchModel& benchModel)
+  {
+    const auto model = loadModel(loader, benchModel.m_Xml);
+    const auto attributes = countAttributes(model);
+    bench.batch(attributes).unit("attribute");
+
+    for (const auto& path : {benchModel.m_Xml, benchModel.m_Json, benchModel.m_Zip}) {
+      bench.run(fmt::format("load {}", path.filename().string()), [&loader, &path] {
+        ankerl::nanobench::doNotOptimizeAway(loadModel(loader, path).getComponents().size());
+      });
+    }
+
+    {
+      const auto validator = rexsapi::xml::TXSDSchemaValidatorCache::get(databasePath / "rexs-schema.xsd");
+      pugi::xml_document doc;
+      if (!doc.load_file(benchModel.m_Xml.string().c_str())) {
+        throw std::runtime_error{fmt::format("cannot parse {}", benchModel.m_Xml.string())};
+      }
+      bench.run(fmt::format("xsd validate {}", benchModel.m_Name), [&validator, &doc] {
+        std::vector<std::string> errors;
+        ankerl::nanobench::doNotOptimizeAway(validator->validate(doc, errors));
+      });
+    }
+
+    {
+      const auto validator = rexsapi::TJsonSchemaValidatorCache::get(databasePath / "rexs-schema.json");
+      const auto doc = loadJson(benchModel.m_Json);
+      for (const auto engine : {rexsapi::TJsonValidationEngine::COMPILED, rexsapi::TJsonValidationEngine::VALIJSON}) {
+        const auto name = engine == rexsapi::TJsonValidationEngine::COMPILED ? "compiled" : "valijson";
+        bench.run(fmt::format("json validate {} {}", name, benchModel.m_Name), [&validator, &doc, engine] {
+          std::vector<std::string> errors;
+          ankerl::nanobench::doNotOptimizeAway(validator->validate(doc, errors, engine));
+        });
+      }
+    }
+
+    bench.run(fmt::format("serialize xml {}", benchModel.m_Name), [&model] {
+      rexsapi::XMLStringSerializer stringSerializer;
+      rexsapi::XMLModelSerializer modelSerializer;
+      modelSerializer.serialize(model, stringSerializer);
+      ankerl::nanobench::doNotOptimizeAway(stringSerializer.getModel().size());
+    });
+
+    bench.run(fmt::format("serialize json {}", benchModel.m_Name), [&model] {
+      rexsapi::JsonStringSerializer stringSerializer;
+      rexsapi::JsonModelSerializer modelSerializer;
+      modelSerializer.serialize(model, stringSerializer);
+      ankerl::nanobench::doNotOptimizeAway(stringSerializer.getModel().size());
+    });
+  }
+
+  void benchmarkDecoders(ankerl::nanobench::Bench& bench, size_t arraySize)
+  {
+    std::vector<double> array(arraySize);
+    std::iota(array.begin(), array.end(), 1.0);
+    const auto coded = rexsapi::detail::TCodedValueArray<double>::encode(array);
+    std::string elements;
+    for (const auto value : array) {
+      elements += fmt::format("<c>{}</c>", value);
+    }
+    const std::optional<rexsapi::database::TEnumValues> enumValue;
+    bench.batch(arraySize).unit("element");
+
+    {
+      const std::string document = fmt::format(R"(<component id="1" type="test">
+          <attribute id="array"><array>{}</array></attribute>
+          <attribute id="coded array"><array code="float64">{}</array></attribute>
+        </component>)",
+                                               elements, coded);
+      pugi::xml_document doc;
+      if (!doc.load_string(document.c_str())) {
+        throw std::runtime_error{"cannot parse decoder xml"};
+      }
+      const rexsapi::TXMLValueDecoder decoder;
+      for (const auto id : {"array", "coded array"}) {
+        const auto node = doc.select_node(fmt::format("/component/attribute[@id='{}']", id).c_str()).node();
+        bench.run(fmt::format("decode xml {} {}", id, arraySize), [&decoder, &enumValue, &node] {
+          ankerl::nanobench::doNotOptimizeAway(
+            decoder.decode(rexsapi::TValueType::FLOATING_POINT_ARRAY, enumValue, node).second);
+        });
+      }
+    }
+
+    {
+      rexsapi::json doc;
+      doc["array"]["floating_point_array"] = array;
+      doc["coded array"]["floating_point_array_coded"] = rexsapi::json{{"code", "float64"}, {"value", coded}};
+      const rexsapi::TJsonValueDecoder decoder;
+      for (const auto id : {"array", "coded array"}) {
+        const auto& node = doc[id];
+        bench.run(fmt::format("decode json {} {}", id, arraySize), [&decoder, &enumValue, &node] {
+          ankerl::nanobench::doNotOptimizeAway(
+            decoder.decode(rexsapi::TValueType::FLOATING_POINT_ARRAY, enumValue, node).second);
+        });
+      }
+    }
+  }
+
+  TBenchModel storeModel(const rexsapi::TModel& model, const std::filesystem::path& directory, const std::string& name)
+  {
+    rexsapi::TResult result;
+    rexsapi::TModelSaver saver;
+    saver.store(result, model, directory / name, rexsapi::TSaveType::XML);
+    saver.store(result, model, directory / name, rexsapi::TSaveType::JSON);
+    saver.store(result, model, directory / name, rexsapi::TSaveType::COMPRESSED_XML);
+    if (!result) {
+      throw std::runtime_error{fmt::format("cannot store model {}", name)};
+    }
+    return TBenchModel{name, directory / (name + ".rexs"), directory / (name + ".rexsj"),
+                       directory / (name + ".rexsz")};
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  try {
+    const std::filesystem::path output = argc > 1 ? argv[1] : "rexsapi_bench.json";
+    const size_t scale = argc > 2 ? std::stoul(argv[2]) : 1;
+    const auto databasePath = projectDir() / "models";
+    const auto modelPath = std::filesystem::temp_directory_path() / "rexsapi_bench";
+    std::filesystem::create_directories(modelPath);
+
+    ankerl::nanobench::Bench bench;
+    bench.title("rexsapi").performanceCounters(false);
+
+    benchmarkRegistry(bench, databasePath);
+
+    const auto registry = createRegistry(databasePath, rexsapi::database::TLoadMode::PARALLEL);
+    const auto& databaseModel = registry.getModel({1, 4}, "en");
+    const rexsapi::TModelLoader loader{databasePath};
+
+    std::vector<TBenchModel> models;
+    for (const auto& name : {"FVA-Industriegetriebe_2stufig_1-4", "FVA_worm_stage_1-4"}) {
+      const auto model = loadModel(loader, projectDir() / "test" / "example_models" / (std::string{name} + ".rexs"));
+      models.emplace_back(storeModel(model, modelPath, name));
+    }
+
+    rexsapi::TModelGeneratorOptions small;
+    small.m_Components = 100 * scale;
+    small.m_LoadCases = 2;
+    rexsapi::TModelGeneratorOptions large;
+    large.m_Components = 1000 * scale;
+    large.m_AttributesPerComponent = 50;
+    large.m_ArraySize = 64;
+    large.m_MatrixSize = 8;
+    large.m_CodeType = rexsapi::TCodeType::Default;
+    large.m_LoadCases = 4;
+
+    for (const auto& options : {small, large}) {
+      const rexsapi::TModelGenerator generator{databaseModel, options};
+      benchmarkBuilder(bench, generator, options);
+      models.emplace_back(storeModel(generator.generate(), modelPath, getName(options)));
+    }
+
+    for (const auto& model : models) {
+      benchmarkModel(bench, loader, databasePath, model);
+    }
+
+    for (const size_t arraySize : {size_t{16}, size_t{4096}}) {
+      benchmarkDecoders(bench, arraySize);
+    }
+
+    std::ofstream stream{output};
+    ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, stream);
+    std::cout << "Results written to " << output.string() << "\n";
+  } catch (const std::exception& ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define REXSAPI_ALLOCATION_COUNTER_IMPL
+#include <rexsapi/AllocationCounter.hxx>
+#include <rexsapi/Value.hxx>
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <array>
+#include <iostream>
+#include <numeric>
+
+namespace
+{
+  /// The value layout before arrays and matrices were shared between copies
+  using TLegacyValue = std::variant<std::monostate, double, bool, int64_t, std::string, std::vector<double>,
+                                    std::vector<rexsapi::Bool>, std::vector<int64_t>, std::vector<std::string>,
+                                    std::vector<std::vector<int64_t>>, rexsapi::TMatrix<double>,
+                                    rexsapi::TMatrix<std::string>>;
+
+  double perValue(uint64_t amount, size_t values)
+  {
+    return static_cast<double>(amount) / static_cast<double>(values);
+  }
+
+  template<typename TValueType, typename TFactory>
+  std::vector<TValueType> create(size_t count, TFactory& factory)
+  {
+    std::vector<TValueType> values;
+    values.reserve(count);
+    for (size_t n = 0; n < count; ++n) {
+      values.emplace_back(factory(n));
+    }
+    return values;
+  }
+
+  template<typename TValueType, typename TFactory>
+  void run(ankerl::nanobench::Bench& bench, std::string& report, std::string_view name, size_t count,
+           TFactory&& factory)
+  {
+    // the construction includes creating the payload, like a loader decoding a value
+    rexsapi::TAllocationCounter::TScope constructionScope;
+    const auto values = create<TValueType>(count, factory);
+    const auto constructionAllocations = constructionScope.finish();
+
+    // the copied bytes include the values themselves, not only their payloads
+    rexsapi::TAllocationCounter::TScope copyScope;
+    {
+      std::vector<TValueType> copy{values};
+      ankerl::nanobench::doNotOptimizeAway(copy.size());
+    }
+    const auto copyAllocations = copyScope.finish();
+
+    report += fmt::format("{:<28} {:>7} {:>11.1f} {:>11.1f} {:>11.1f} {:>11.1f}\n", name, sizeof(TValueType),
+                          perValue(constructionAllocations.m_Allocations, count),
+                          perValue(constructionAllocations.m_Bytes, count),
+                          perValue(copyAllocations.m_Allocations, count), perValue(copyAllocations.m_Bytes, count));
+
+    bench.batch(count).unit("value");
+    bench.run(fmt::format("new {}", name), [count, &factory] {
+      ankerl::nanobench::doNotOptimizeAway(create<TValueType>(count, factory).size());
+    });
+    bench.run(fmt::format("copy {}", name), [&values] {
+      std::vector<TValueType> copy{values};
+      ankerl::nanobench::doNotOptimizeAway(copy.size());
+    });
+  }
+
+  template<typename TFactory>
+  void compare(ankerl::nanobench::Bench& bench, std::string& report, std::string_view name, size_t count,
+               TFactory&& factory)
+  {
+    run<TLegacyValue>(bench, report, fmt::format("legacy {}", name), count, [&factory](size_t n) {
+      return TLegacyValue{factory(n)};
+    });
+    run<rexsapi::TValue>(bench, report, fmt::format("value {}", name), count, [&factory](size_t n) {
+      return rexsapi::TValue{factory(n)};
+    });
+  }
+}
+
+
+int main(int, char**)
+{
+  constexpr size_t count = 10000;
+
+  rexsapi::TAllocationCounter::enable();
+
+  ankerl::nanobench::Bench bench;
+  bench.title("value").performanceCounters(false);
+
+  // allocations are counted in a separate pass, as the timed runs repeat the operations
+  auto report = fmt::format("{:<28} {:>7} {:>11} {:>11} {:>11} {:>11}\n", "benchmark", "sizeof", "new allocs",
+                            "new bytes", "copy allocs", "copy bytes");
+
+  compare(bench, report, "double", count, [](size_t n) {
+    return static_cast<double>(n);
+  });
+
+  // enum values and most string values fit into the small string buffer
+  static constexpr std::array<std::string_view, 4> enums{"no_direction", "negative", "positive", "both_directions"};
+  compare(bench, report, "enum", count, [](size_t n) {
+    return std::string{enums[n % enums.size()]};
+  });
+  compare(bench, report, "string[8]", count, [](size_t n) {
+    return std::string(8, static_cast<char>('a' + n % 26));
+  });
+  compare(bench, report, "string[64]", count, [](size_t n) {
+    return std::string(64, static_cast<char>('a' + n % 26));
+  });
+
+  for (size_t size : {size_t{8}, size_t{128}, size_t{4096}}) {
+    std::vector<double> array(size);
+    std::iota(array.begin(), array.end(), 0.0);
+    compare(bench, report, fmt::format("double array[{}]", size), count / 10, [&array](size_t) {
+      return array;
+    });
+  }
+
+  std::cout << "\n" << report;
+
+  return 0;
+}
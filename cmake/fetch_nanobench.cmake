@@ -0,0 +1,11 @@
+FetchContent_Declare(
+  nanobench
+  GIT_REPOSITORY https://github.com/martinus/nanobench
+  GIT_TAG v4.3.11
+)
+
+FetchContent_GetProperties(nanobench)
+
+if(NOT nanobench_POPULATED)
+  FetchContent_Populate(nanobench)
+endif()
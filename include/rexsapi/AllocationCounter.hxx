@@ -0,0 +1,263 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_ALLOCATION_COUNTER_HXX
+#define REXSAPI_ALLOCATION_COUNTER_HXX
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace rexsapi
+{
+  struct TAllocationStatistics {
+    /// The number of allocations
+    uint64_t m_Allocations{0};
+    /// The number of bytes allocated, regardless if they have been freed again
+    uint64_t m_Bytes{0};
+    /// The highest number of live bytes above the live bytes at the start
+    uint64_t m_PeakBytes{0};
+  };
+
+
+  /**
+   * @brief Counts the heap allocations of the process.
+   *
+   * Counting is opt-in. Define REXSAPI_ALLOCATION_COUNTER_IMPL right before including this header in *exactly* one
+   * compilation unit of an executable to replace the global operator new and delete with counting versions, and call
+   * enable to start counting. Over-aligned allocations are not counted.
+   *
+   * The counters are global, so allocations of all threads are counted. Scopes expect to be nested and are only
+   * meaningful if no other thread allocates concurrently.
+   */
+  class TAllocationCounter
+  {
+  public:
+    /**
+     * @brief Measures the allocations from construction to finish.
+     */
+    class TScope
+    {
+    public:
+      TScope() noexcept;
+
+      ~TScope()
+      {
+        finish();
+      }
+
+      TScope(const TScope&) = delete;
+      TScope& operator=(const TScope&) = delete;
+      TScope(TScope&&) = delete;
+      TScope& operator=(TScope&&) = delete;
+
+      /// Stops measuring, later calls return the same statistics
+      TAllocationStatistics finish() noexcept;
+
+    private:
+      bool m_Finished{false};
+      uint64_t m_Allocations;
+      uint64_t m_Bytes;
+      int64_t m_LiveBytes;
+      int64_t m_OuterPeak;
+      TAllocationStatistics m_Statistics{};
+    };
+
+    /// True if the counting operators have been compiled into the executable and counting has been enabled
+    [[nodiscard]] static bool isEnabled() noexcept
+    {
+      return m_Available.load(std::memory_order_relaxed) && m_Enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Enables or disables counting, has no effect without REXSAPI_ALLOCATION_COUNTER_IMPL
+    static void enable(bool enabled = true) noexcept
+    {
+      m_Enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    static void allocated(size_t bytes) noexcept;
+
+    static void deallocated(size_t bytes) noexcept;
+
+    /// Only called by the counting operators
+    static void setAvailable() noexcept
+    {
+      m_Available.store(true, std::memory_order_relaxed);
+    }
+
+  private:
+    static inline std::atomic<bool> m_Available{false};
+    static inline std::atomic<bool> m_Enabled{false};
+    static inline std::atomic<uint64_t> m_Allocations{0};
+    static inline std::atomic<uint64_t> m_Bytes{0};
+    // ATTENTION: live bytes are signed, memory allocated before counting was enabled may be freed while counting
+    static inline std::atomic<int64_t> m_LiveBytes{0};
+    static inline std::atomic<int64_t> m_PeakBytes{0};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline void TAllocationCounter::allocated(size_t bytes) noexcept
+  {
+    if (!m_Enabled.load(std::memory_order_relaxed)) {
+      return;
+    }
+    m_Allocations.fetch_add(1, std::memory_order_relaxed);
+    m_Bytes.fetch_add(bytes, std::memory_order_relaxed);
+    const auto live = m_LiveBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+                      static_cast<int64_t>(bytes);
+    auto peak = m_PeakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !m_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+  }
+
+  inline void TAllocationCounter::deallocated(size_t bytes) noexcept
+  {
+    if (m_Enabled.load(std::memory_order_relaxed)) {
+      m_LiveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    }
+  }
+
+  inline TAllocationCounter::TScope::TScope() noexcept
+  : m_Allocations{TAllocationCounter::m_Allocations.load(std::memory_order_relaxed)}
+  , m_Bytes{TAllocationCounter::m_Bytes.load(std::memory_order_relaxed)}
+  , m_LiveBytes{TAllocationCounter::m_LiveBytes.load(std::memory_order_relaxed)}
+  , m_OuterPeak{TAllocationCounter::m_PeakBytes.exchange(m_LiveBytes, std::memory_order_relaxed)}
+  {
+  }
+
+  inline TAllocationStatistics TAllocationCounter::TScope::finish() noexcept
+  {
+    if (m_Finished) {
+      return m_Statistics;
+    }
+    m_Finished = true;
+    // the peak of an outer scope is the maximum of its own peak and the peaks of all inner scopes
+    const auto peak = TAllocationCounter::m_PeakBytes.load(std::memory_order_relaxed);
+    TAllocationCounter::m_PeakBytes.store(std::max(peak, m_OuterPeak), std::memory_order_relaxed);
+    m_Statistics.m_Allocations = TAllocationCounter::m_Allocations.load(std::memory_order_relaxed) - m_Allocations;
+    m_Statistics.m_Bytes = TAllocationCounter::m_Bytes.load(std::memory_order_relaxed) - m_Bytes;
+    m_Statistics.m_PeakBytes = static_cast<uint64_t>(std::max<int64_t>(peak - m_LiveBytes, 0));
+    return m_Statistics;
+  }
+}
+
+
+#ifdef REXSAPI_ALLOCATION_COUNTER_IMPL
+
+  #include <cstdlib>
+  #include <new>
+
+namespace rexsapi::detail
+{
+  // the size of an allocation is stored in front of the returned memory, the offset keeps the fundamental alignment
+  static constexpr size_t AllocationOffset = alignof(std::max_align_t);
+
+  static void* countedAllocate(size_t bytes) noexcept
+  {
+    auto* memory = static_cast<unsigned char*>(std::malloc(bytes + AllocationOffset));
+    if (memory == nullptr) {
+      return nullptr;
+    }
+    *reinterpret_cast<size_t*>(memory) = bytes;
+    TAllocationCounter::allocated(bytes);
+    return memory + AllocationOffset;
+  }
+
+  static void countedFree(void* ptr) noexcept
+  {
+    if (ptr == nullptr) {
+      return;
+    }
+    auto* memory = static_cast<unsigned char*>(ptr) - AllocationOffset;
+    TAllocationCounter::deallocated(*reinterpret_cast<size_t*>(memory));
+    std::free(memory);
+  }
+
+  static void* countedNew(size_t bytes)
+  {
+    while (true) {
+      if (auto* ptr = countedAllocate(bytes); ptr != nullptr) {
+        return ptr;
+      }
+      auto handler = std::get_new_handler();
+      if (handler == nullptr) {
+        throw std::bad_alloc{};
+      }
+      handler();
+    }
+  }
+
+  static const bool CountingOperatorsAvailable = (TAllocationCounter::setAvailable(), true);
+}
+
+void* operator new(size_t bytes)
+{
+  return rexsapi::detail::countedNew(bytes);
+}
+
+void* operator new[](size_t bytes)
+{
+  return rexsapi::detail::countedNew(bytes);
+}
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept
+{
+  return rexsapi::detail::countedAllocate(bytes);
+}
+
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept
+{
+  return rexsapi::detail::countedAllocate(bytes);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  rexsapi::detail::countedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  rexsapi::detail::countedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  rexsapi::detail::countedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+  rexsapi::detail::countedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  rexsapi::detail::countedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  rexsapi::detail::countedFree(ptr);
+}
+
+#endif
+
+#endif
@@ -17,17 +17,67 @@
 #ifndef REXSAPI_ATTRIBUTE_HXX
 #define REXSAPI_ATTRIBUTE_HXX
 
+#include <rexsapi/Result.hxx>
 #include <rexsapi/Unit.hxx>
 #include <rexsapi/Value.hxx>
 #include <rexsapi/database/Attribute.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
 namespace rexsapi
 {
+  /**
+   * @brief An attribute value that is decoded on first access.
+   *
+   * Decoding is thread-safe and happens exactly once. Issues found while decoding are collected in an own result, as
+   * the result of the load operation is usually gone by then. The decoder and everything it captured is released after
+   * decoding.
+   */
+  class TLazyValue
+  {
+  public:
+    using TDecoder = std::function<TValue(TResult&)>;
+
+    explicit TLazyValue(TDecoder decoder)
+    : m_Decoder{std::move(decoder)}
+    {
+    }
+
+    TLazyValue(const TLazyValue&) = delete;
+    TLazyValue& operator=(const TLazyValue&) = delete;
+
+    [[nodiscard]] const TValue& get() const;
+
+    [[nodiscard]] const TResult& getResult() const
+    {
+      static_cast<void>(get());
+      return m_Result;
+    }
+
+    [[nodiscard]] bool isDecoded() const
+    {
+      return m_Decoded.load(std::memory_order_acquire);
+    }
+
+  private:
+    mutable std::once_flag m_Once;
+    mutable std::atomic<bool> m_Decoded{false};
+    mutable TDecoder m_Decoder;
+    mutable TValue m_Value;
+    mutable TResult m_Result;
+  };
+
+
   class TAttribute
   {
   public:
     TAttribute(const database::TAttribute& attribute, TUnit unit, TValue value)
-    : m_AttributeWrapper{AttributeWrapper{attribute}}
+    : m_AttributeWrapper{AttributeWrapper{&attribute}}
     , m_Unit{std::move(unit)}
     , m_Value{std::move(value)}
     {
@@ -37,6 +87,12 @@ namespace rexsapi
       }
     }
 
+    TAttribute(const database::TAttribute& attribute, TUnit unit, std::shared_ptr<const TLazyValue> value)
+    : TAttribute{attribute, std::move(unit), TValue{}}
+    {
+      m_LazyValue = std::move(value);
+    }
+
     TAttribute(std::string attributeId, TUnit unit, TValueType type, TValue value)
     : m_CustomAttributeId{std::move(attributeId)}
     , m_CustomValueType{type}
@@ -57,6 +113,28 @@ namespace rexsapi
     {
     }
 
+    /**
+     * @brief Checks if the value has already been decoded.
+     *
+     * Only attributes loaded with TDecodeMode::LAZY can have values that have not been decoded yet.
+     */
+    [[nodiscard]] bool isDecoded() const
+    {
+      return !m_LazyValue || m_LazyValue->isDecoded();
+    }
+
+    /**
+     * @brief Decodes the value if necessary and adds all issues found while decoding to the result.
+     */
+    void checkValue(TResult& result) const
+    {
+      if (m_LazyValue) {
+        for (const auto& error : m_LazyValue->getResult().getErrors()) {
+          result.addError(error);
+        }
+      }
+    }
+
     [[nodiscard]] bool isCustomAttribute() const
     {
       return !m_AttributeWrapper.has_value();
@@ -65,7 +143,7 @@ namespace rexsapi
     [[nodiscard]] const std::string& getAttributeId() const&
     {
       if (m_AttributeWrapper) {
-        return m_AttributeWrapper->m_Attribute.getAttributeId();
+        return m_AttributeWrapper->m_Attribute->getAttributeId();
       }
       return m_CustomAttributeId;
     }
@@ -73,7 +151,7 @@ namespace rexsapi
     [[nodiscard]] const std::string& getName() const&
     {
       if (m_AttributeWrapper) {
-        return m_AttributeWrapper->m_Attribute.getName();
+        return m_AttributeWrapper->m_Attribute->getName();
       }
       return m_CustomAttributeId;
     }
@@ -86,35 +164,56 @@ namespace rexsapi
     [[nodiscard]] TValueType getValueType() const
     {
       if (m_AttributeWrapper) {
-        return m_AttributeWrapper->m_Attribute.getValueType();
+        return m_AttributeWrapper->m_Attribute->getValueType();
       }
       return *m_CustomValueType;
     }
 
     [[nodiscard]] bool hasValue() const
     {
-      return !m_Value.isEmpty();
+      return !getValue().isEmpty();
     }
 
     [[nodiscard]] const TValue& getValue() const&
     {
+      if (m_LazyValue) {
+        return m_LazyValue->get();
+      }
       return m_Value;
     }
 
     template<typename T>
     [[nodiscard]] const auto& getValue() const&
     {
-      return m_Value.getValue<T>();
+      return getValue().getValue<T>();
     }
 
     [[nodiscard]] std::string getValueAsString() const
     {
-      return m_Value.asString();
+      return getValue().asString();
     }
 
+    /**
+     * @brief Returns the ordinal of an enum value in the enum values of the database attribute.
+     *
+     * @throws TException if the attribute is no enum attribute or the value is not a valid enum value
+     */
+    [[nodiscard]] size_t getEnumOrdinal() const;
+
+    /**
+     * @brief Returns the ordinals of the values of an enum array in the enum values of the database attribute.
+     *
+     * @throws TException if the attribute is no enum array attribute or a value is not a valid enum value
+     */
+    [[nodiscard]] std::vector<size_t> getEnumOrdinals() const;
+
   private:
+    const database::TEnumValues& getEnumValues(TValueType type) const;
+
+    size_t getEnumOrdinal(const database::TEnumValues& enums, const std::string& value) const;
+
     struct AttributeWrapper {
-      const database::TAttribute& m_Attribute;
+      const database::TAttribute* m_Attribute;
     };
     std::optional<AttributeWrapper> m_AttributeWrapper;
 
@@ -123,9 +222,111 @@ namespace rexsapi
 
     TUnit m_Unit;
     TValue m_Value;
+    std::shared_ptr<const TLazyValue> m_LazyValue;
   };
 
   using TAttributes = std::vector<TAttribute>;
+
+
+  namespace detail
+  {
+    /**
+     * @brief Index of attributes sorted by attribute id.
+     *
+     * Stores the positions of the attributes instead of the ids, so a copy of the attributes can use a copy of the
+     * index. If attribute ids are not unique, the first attribute with the id is found.
+     */
+    class TAttributeIndex
+    {
+    public:
+      TAttributeIndex() = default;
+
+      explicit TAttributeIndex(const TAttributes& attributes);
+
+      [[nodiscard]] const TAttribute* find(const TAttributes& attributes, std::string_view attributeId) const;
+
+    private:
+      std::vector<uint32_t> m_Positions;
+    };
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline const TValue& TLazyValue::get() const
+  {
+    std::call_once(m_Once, [this]() {
+      try {
+        m_Value = m_Decoder(m_Result);
+      } catch (const std::exception& ex) {
+        m_Result.addError(TError{TErrorLevel::ERR, fmt::format("cannot decode value: {}", ex.what())});
+      }
+      m_Decoder = nullptr;
+      m_Decoded.store(true, std::memory_order_release);
+    });
+    return m_Value;
+  }
+
+  inline size_t TAttribute::getEnumOrdinal() const
+  {
+    return getEnumOrdinal(getEnumValues(TValueType::ENUM), getValue<TEnumType>());
+  }
+
+  inline std::vector<size_t> TAttribute::getEnumOrdinals() const
+  {
+    const auto& enums = getEnumValues(TValueType::ENUM_ARRAY);
+    const auto& values = getValue<TEnumArrayType>();
+    std::vector<size_t> ordinals;
+    ordinals.reserve(values.size());
+    for (const auto& value : values) {
+      ordinals.emplace_back(getEnumOrdinal(enums, value));
+    }
+    return ordinals;
+  }
+
+  inline const database::TEnumValues& TAttribute::getEnumValues(TValueType type) const
+  {
+    if (getValueType() != type || !m_AttributeWrapper || !m_AttributeWrapper->m_Attribute->getEnums()) {
+      throw TException{
+        fmt::format("attribute id={} has no enum values of type {}", getAttributeId(), toTypeString(type))};
+    }
+    return *m_AttributeWrapper->m_Attribute->getEnums();
+  }
+
+  inline detail::TAttributeIndex::TAttributeIndex(const TAttributes& attributes)
+  {
+    m_Positions.resize(attributes.size());
+    for (size_t n = 0; n < attributes.size(); ++n) {
+      m_Positions[n] = static_cast<uint32_t>(n);
+    }
+    std::stable_sort(m_Positions.begin(), m_Positions.end(), [&attributes](uint32_t lhs, uint32_t rhs) {
+      return attributes[lhs].getAttributeId() < attributes[rhs].getAttributeId();
+    });
+  }
+
+  inline const TAttribute* detail::TAttributeIndex::find(const TAttributes& attributes,
+                                                         std::string_view attributeId) const
+  {
+    const auto it = std::lower_bound(m_Positions.begin(), m_Positions.end(), attributeId,
+                                     [&attributes](uint32_t position, std::string_view id) {
+                                       return std::string_view{attributes[position].getAttributeId()} < id;
+                                     });
+    if (it == m_Positions.end() || attributes[*it].getAttributeId() != attributeId) {
+      return nullptr;
+    }
+    return &attributes[*it];
+  }
+
+  inline size_t TAttribute::getEnumOrdinal(const database::TEnumValues& enums, const std::string& value) const
+  {
+    const auto ordinal = enums.getOrdinal(value);
+    if (!ordinal) {
+      throw TException{fmt::format("value {} of attribute id={} is not a valid enum value", value, getAttributeId())};
+    }
+    return *ordinal;
+  }
 }
 
 #endif
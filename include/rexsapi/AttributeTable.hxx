@@ -0,0 +1,451 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_ATTRIBUTE_TABLE_HXX
+#define REXSAPI_ATTRIBUTE_TABLE_HXX
+
+#include <rexsapi/Model.hxx>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+namespace rexsapi
+{
+  enum class TColumnType {
+    FLOATING_POINT,  ///< 64 bit floating point values
+    INTEGER          ///< 64 bit signed integer values
+  };
+
+  static std::string toColumnTypeString(TColumnType type);
+
+
+  /**
+   * @brief Memory layout of the buffers of a column.
+   */
+  enum class TColumnLayout {
+    COMPACT,  ///< Buffers are aligned to and padded to 8 bytes
+    ARROW     ///< Buffers are aligned to and padded to 64 bytes as recommended by the Apache Arrow format
+  };
+
+
+  namespace detail
+  {
+    /**
+     * @brief Growable, zero initialized byte buffer with a fixed alignment.
+     *
+     * The capacity is always a multiple of the alignment and all bytes beyond the size are zero, so the padding of a
+     * buffer never contains stale data.
+     */
+    class TColumnBuffer
+    {
+    public:
+      explicit TColumnBuffer(size_t alignment) noexcept
+      : m_Alignment{alignment}
+      , m_Data{nullptr, TDeleter{alignment}}
+      {
+      }
+
+      ~TColumnBuffer() = default;
+
+      TColumnBuffer(const TColumnBuffer& buffer);
+      TColumnBuffer& operator=(const TColumnBuffer& buffer);
+      TColumnBuffer(TColumnBuffer&&) noexcept = default;
+      TColumnBuffer& operator=(TColumnBuffer&&) noexcept = default;
+
+      [[nodiscard]] const unsigned char* data() const noexcept
+      {
+        return m_Data.get();
+      }
+
+      [[nodiscard]] unsigned char* data() noexcept
+      {
+        return m_Data.get();
+      }
+
+      [[nodiscard]] size_t size() const noexcept
+      {
+        return m_Size;
+      }
+
+      /// Growing fills with zeros, shrinking zeros the removed bytes
+      void resize(size_t size);
+
+    private:
+      struct TDeleter {
+        size_t m_Alignment;
+
+        void operator()(unsigned char* data) const noexcept
+        {
+          ::operator delete(data, std::align_val_t{m_Alignment});
+        }
+      };
+
+      void reallocate(size_t capacity);
+
+      size_t m_Alignment;
+      size_t m_Size{0};
+      size_t m_Capacity{0};
+      std::unique_ptr<unsigned char[], TDeleter> m_Data;
+    };
+  }
+
+
+  /**
+   * @brief A column of an attribute table.
+   *
+   * The values are stored in one contiguous buffer of 64 bit values, the validity of the values in a bitmap with one
+   * bit per row in least significant bit order as used by the Apache Arrow format. Values of rows without a value
+   * are zero.
+   */
+  class TAttributeColumn
+  {
+  public:
+    TAttributeColumn(std::string attributeId, TColumnLayout layout);
+
+    [[nodiscard]] const std::string& getAttributeId() const&
+    {
+      return m_AttributeId;
+    }
+
+    /// The type is taken from the first value, columns without any value are floating point columns
+    [[nodiscard]] TColumnType getType() const noexcept
+    {
+      return m_Type.value_or(TColumnType::FLOATING_POINT);
+    }
+
+    /// The unit of the first value
+    [[nodiscard]] const TUnit& getUnit() const&
+    {
+      return m_Unit;
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Rows;
+    }
+
+    [[nodiscard]] size_t getNullCount() const noexcept
+    {
+      return m_NullCount;
+    }
+
+    [[nodiscard]] bool isValid(size_t row) const noexcept
+    {
+      return (static_cast<unsigned>(m_Validity.data()[row / 8]) >> (row % 8)) & 1U;
+    }
+
+    /**
+     * @brief Returns the values of the column.
+     *
+     * @tparam T double for floating point columns and int64_t for integer columns
+     * @throws TException if the type does not match the column type
+     */
+    template<typename T>
+    [[nodiscard]] const T* getData() const;
+
+    /// The validity bitmap, a set bit marks a row with a value
+    [[nodiscard]] const uint8_t* getValidity() const noexcept
+    {
+      return m_Validity.data();
+    }
+
+  private:
+    friend class TAttributeTable;
+
+    void append(const TComponentRange& components);
+
+    void truncate(size_t rows);
+
+    std::string m_AttributeId;
+    std::optional<TColumnType> m_Type;
+    TUnit m_Unit;
+    size_t m_Rows{0};
+    size_t m_NullCount{0};
+    detail::TColumnBuffer m_Data;
+    detail::TColumnBuffer m_Validity;
+  };
+
+
+  /**
+   * @brief Columnar table of attributes of all components of a component type.
+   *
+   * Every component of the type adds a row, every attribute id a column. Rows of multiple models can be collected in
+   * one table by appending the models one after the other. Floating point attributes are stored as double columns,
+   * integer and reference component attributes as int64_t columns. The buffers of a column can be handed over to
+   * vectorized code or wrapped as Apache Arrow float64 and int64 arrays without copying.
+   */
+  class TAttributeTable
+  {
+  public:
+    TAttributeTable(std::string componentType, const std::vector<std::string>& attributeIds,
+                    TColumnLayout layout = TColumnLayout::COMPACT);
+
+    /**
+     * @brief Appends a row for every component of the component type in model order.
+     *
+     * @throws TException if an attribute has a type that cannot be stored in a column or does not match the type of
+     *                    the column. The table is unchanged in this case.
+     */
+    void append(const TModel& model);
+
+    [[nodiscard]] const std::string& getComponentType() const&
+    {
+      return m_ComponentType;
+    }
+
+    [[nodiscard]] size_t getRowCount() const noexcept
+    {
+      return m_InternalIds.size();
+    }
+
+    [[nodiscard]] const std::vector<TAttributeColumn>& getColumns() const&
+    {
+      return m_Columns;
+    }
+
+    /// @throws TException if the table has no column for the attribute
+    [[nodiscard]] const TAttributeColumn& getColumn(std::string_view attributeId) const&;
+
+    /// The internal component id of every row
+    [[nodiscard]] const std::vector<uint64_t>& getInternalIds() const&
+    {
+      return m_InternalIds;
+    }
+
+    /// The first row of every appended model followed by the row count
+    [[nodiscard]] const std::vector<size_t>& getModelOffsets() const&
+    {
+      return m_ModelOffsets;
+    }
+
+  private:
+    std::string m_ComponentType;
+    std::vector<TAttributeColumn> m_Columns;
+    std::vector<uint64_t> m_InternalIds;
+    std::vector<size_t> m_ModelOffsets{0};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  namespace detail
+  {
+    inline TColumnBuffer::TColumnBuffer(const TColumnBuffer& buffer)
+    : m_Alignment{buffer.m_Alignment}
+    , m_Data{nullptr, TDeleter{buffer.m_Alignment}}
+    {
+      reallocate(buffer.m_Capacity);
+      m_Size = buffer.m_Size;
+      if (m_Size) {
+        std::memcpy(m_Data.get(), buffer.m_Data.get(), m_Size);
+      }
+    }
+
+    inline TColumnBuffer& TColumnBuffer::operator=(const TColumnBuffer& buffer)
+    {
+      if (this != &buffer) {
+        TColumnBuffer copy{buffer};
+        *this = std::move(copy);
+      }
+      return *this;
+    }
+
+    inline void TColumnBuffer::resize(size_t size)
+    {
+      if (size > m_Capacity) {
+        reallocate(std::max(size, 2 * m_Capacity));
+      } else if (size < m_Size) {
+        std::memset(m_Data.get() + size, 0, m_Size - size);
+      }
+      m_Size = size;
+    }
+
+    inline void TColumnBuffer::reallocate(size_t capacity)
+    {
+      capacity = (capacity + m_Alignment - 1) / m_Alignment * m_Alignment;
+      if (capacity == 0) {
+        return;
+      }
+      std::unique_ptr<unsigned char[], TDeleter> data{
+        static_cast<unsigned char*>(::operator new(capacity, std::align_val_t{m_Alignment})), TDeleter{m_Alignment}};
+      if (m_Size) {
+        std::memcpy(data.get(), m_Data.get(), m_Size);
+      }
+      std::memset(data.get() + m_Size, 0, capacity - m_Size);
+      m_Data = std::move(data);
+      m_Capacity = capacity;
+    }
+  }
+
+  static inline std::string toColumnTypeString(TColumnType type)
+  {
+    switch (type) {
+      case TColumnType::FLOATING_POINT:
+        return "floating_point";
+      case TColumnType::INTEGER:
+        return "integer";
+    }
+    throw TException{"unknown column type"};
+  }
+
+  inline TAttributeColumn::TAttributeColumn(std::string attributeId, TColumnLayout layout)
+  : m_AttributeId{std::move(attributeId)}
+  , m_Data{layout == TColumnLayout::ARROW ? size_t{64} : size_t{8}}
+  , m_Validity{layout == TColumnLayout::ARROW ? size_t{64} : size_t{8}}
+  {
+  }
+
+  template<typename T>
+  inline const T* TAttributeColumn::getData() const
+  {
+    static_assert(std::is_same_v<T, double> || std::is_same_v<T, int64_t>, "columns only store double or int64_t");
+    const auto type = std::is_same_v<T, double> ? TColumnType::FLOATING_POINT : TColumnType::INTEGER;
+    if (type != getType()) {
+      throw TException{fmt::format("column for attribute id={} is of type {}", m_AttributeId,
+                                   toColumnTypeString(getType()))};
+    }
+    return reinterpret_cast<const T*>(m_Data.data());
+  }
+
+  inline void TAttributeColumn::append(const TComponentRange& components)
+  {
+    const auto rows = m_Rows + components.size();
+    m_Data.resize(rows * sizeof(int64_t));
+    m_Validity.resize((rows + 7) / 8);
+
+    auto* data = m_Data.data();
+    auto* validity = m_Validity.data();
+    for (const auto& component : components) {
+      const auto row = m_Rows;
+      const auto* attribute = component.findAttribute(m_AttributeId);
+      if (attribute == nullptr || !attribute->hasValue()) {
+        ++m_NullCount;
+        ++m_Rows;
+        continue;
+      }
+
+      TColumnType type;
+      int64_t integer{0};
+      double floatingPoint{0.0};
+      switch (attribute->getValueType()) {
+        case TValueType::FLOATING_POINT:
+          type = TColumnType::FLOATING_POINT;
+          floatingPoint = attribute->getValue<TFloatType>();
+          break;
+        case TValueType::INTEGER:
+          type = TColumnType::INTEGER;
+          integer = attribute->getValue<TIntType>();
+          break;
+        case TValueType::REFERENCE_COMPONENT:
+          type = TColumnType::INTEGER;
+          integer = attribute->getValue<TReferenceComponentType>();
+          break;
+        default:
+          throw TException{
+            fmt::format("attribute id={} of component id={} has type {} which cannot be stored in a column",
+                        m_AttributeId, component.getInternalId(), toTypeString(attribute->getValueType()))};
+      }
+      if (m_Type && *m_Type != type) {
+        throw TException{fmt::format("attribute id={} of component id={} has type {} but the column is of type {}",
+                                     m_AttributeId, component.getInternalId(), toTypeString(attribute->getValueType()),
+                                     toColumnTypeString(*m_Type))};
+      }
+      if (!m_Type) {
+        m_Type = type;
+        m_Unit = attribute->getUnit();
+      }
+
+      if (type == TColumnType::FLOATING_POINT) {
+        std::memcpy(data + row * sizeof(double), &floatingPoint, sizeof(double));
+      } else {
+        std::memcpy(data + row * sizeof(int64_t), &integer, sizeof(int64_t));
+      }
+      validity[row / 8] = static_cast<uint8_t>(validity[row / 8] | (1U << (row % 8)));
+      ++m_Rows;
+    }
+  }
+
+  inline void TAttributeColumn::truncate(size_t rows)
+  {
+    for (size_t row = rows; row < m_Rows; ++row) {
+      if (!isValid(row)) {
+        --m_NullCount;
+      }
+    }
+    // clear the bits of the removed rows sharing the last byte with kept rows
+    if (rows % 8) {
+      m_Validity.data()[rows / 8] = static_cast<uint8_t>(m_Validity.data()[rows / 8] & ((1U << (rows % 8)) - 1));
+    }
+    m_Data.resize(rows * sizeof(int64_t));
+    m_Validity.resize((rows + 7) / 8);
+    m_Rows = rows;
+    // the type is taken from the first value, so it has to be taken again if no value is left
+    if (m_NullCount == m_Rows) {
+      m_Type.reset();
+      m_Unit = TUnit{};
+    }
+  }
+
+  inline TAttributeTable::TAttributeTable(std::string componentType, const std::vector<std::string>& attributeIds,
+                                          TColumnLayout layout)
+  : m_ComponentType{std::move(componentType)}
+  {
+    m_Columns.reserve(attributeIds.size());
+    for (const auto& attributeId : attributeIds) {
+      m_Columns.emplace_back(TAttributeColumn{attributeId, layout});
+    }
+  }
+
+  inline void TAttributeTable::append(const TModel& model)
+  {
+    const auto components = model.findComponentsByType(m_ComponentType);
+    const auto rows = getRowCount();
+    try {
+      for (auto& column : m_Columns) {
+        column.append(components);
+      }
+      m_InternalIds.reserve(rows + components.size());
+      for (const auto& component : components) {
+        m_InternalIds.emplace_back(component.getInternalId());
+      }
+    } catch (...) {
+      for (auto& column : m_Columns) {
+        column.truncate(rows);
+      }
+      m_InternalIds.resize(rows);
+      throw;
+    }
+    m_ModelOffsets.emplace_back(getRowCount());
+  }
+
+  inline const TAttributeColumn& TAttributeTable::getColumn(std::string_view attributeId) const&
+  {
+    for (const auto& column : m_Columns) {
+      if (column.getAttributeId() == attributeId) {
+        return column;
+      }
+    }
+    throw TException{fmt::format("attribute table has no column for attribute id={}", attributeId)};
+  }
+}
+
+#endif
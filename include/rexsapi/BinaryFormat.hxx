@@ -0,0 +1,694 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_BINARY_FORMAT_HXX
+#define REXSAPI_BINARY_FORMAT_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+#include <rexsapi/Model.hxx>
+#include <rexsapi/Types.hxx>
+#include <rexsapi/Value.hxx>
+
+#include <array>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Layout of a binary REXS file (version 1). All numbers are little-endian, all offsets are absolute file offsets and
+ * every record starts 8-byte aligned, so arrays can be accessed in place.
+ *
+ * header      magic "REXSBIN\0", u32 format version, u32 flags, u64 offsets of info, components, relations, load
+ *             spectrum and string sections
+ * info        u32 application id, u32 application version, u32 date, u32 major, u32 minor, u8 has language,
+ *             u32 language (all strings are indices into the string table)
+ * components  u64 count, u64 offset per component
+ *   component u64 internal id, u32 type, u32 name, u64 attribute count, u64 offset per attribute
+ *   attribute u32 id, u32 unit, u8 value type, u8 flags, u8 code type, payload at +16
+ * relations   u64 count, u64 offset per relation
+ *   relation  u8 type, u8 has order, u32 order, u64 reference count, 16 bytes per reference: u8 role, u32 hint,
+ *             u64 component index
+ * spectrum    u64 load case count, u64 accumulation offset or 0, u64 offset per load case
+ *   load case u64 count, u64 offset per load component
+ *   load comp u64 component index, u64 attribute count, u64 offset per attribute
+ * strings     u64 count, (u64 offset, u64 length) per string, utf-8 data
+ */
+
+namespace rexsapi::binary
+{
+  constexpr std::array<char, 8> Magic{'R', 'E', 'X', 'S', 'B', 'I', 'N', '\0'};
+  constexpr uint32_t FormatVersion = 1;
+  constexpr uint64_t HeaderSize = 56;
+  constexpr uint64_t AttributeHeaderSize = 16;
+  constexpr uint64_t ReferenceSize = 16;
+  constexpr uint8_t CustomAttributeFlag = 0x01;
+  constexpr uint8_t HasValueFlag = 0x02;
+
+  enum class TSection : uint8_t { INFO, COMPONENTS, RELATIONS, SPECTRUM, STRINGS };
+
+
+  static inline bool isLittleEndian()
+  {
+    const uint16_t value = 1;
+    uint8_t byte;
+    ::memcpy(&byte, &value, 1);
+    return byte == 1;
+  }
+
+
+  class TBinaryWriter
+  {
+  public:
+    TBinaryWriter();
+
+    template<typename T>
+    void write(T value);
+
+    template<typename T>
+    void writeAt(uint64_t offset, T value);
+
+    template<typename T>
+    void writeArray(const T* values, size_t count);
+
+    uint64_t reserve(uint64_t size);
+
+    void align();
+
+    [[nodiscard]] uint64_t position() const
+    {
+      return m_Buffer.size();
+    }
+
+    // ATTENTION: interned strings are referenced, not copied, and have to outlive the writer
+    uint32_t intern(const std::string& s);
+
+    void setSection(TSection section, uint64_t offset);
+
+    std::vector<uint8_t> release();
+
+  private:
+    std::vector<uint8_t> m_Buffer;
+    std::vector<const std::string*> m_Strings;
+    std::unordered_map<std::string_view, uint32_t> m_StringIndex;
+  };
+
+
+  struct TBinaryComponentRecord {
+    uint64_t m_InternalId;
+    uint32_t m_Type;
+    uint32_t m_Name;
+    uint64_t m_AttributeCount;
+    uint64_t m_AttributeTable;
+  };
+
+  struct TBinaryAttributeRecord {
+    uint32_t m_Id;
+    uint32_t m_Unit;
+    TValueType m_Type;
+    uint8_t m_Flags;
+    TCodeType m_CodeType;
+    uint64_t m_Payload;
+
+    [[nodiscard]] bool isCustom() const
+    {
+      return (m_Flags & CustomAttributeFlag) != 0;
+    }
+
+    [[nodiscard]] bool hasValue() const
+    {
+      return (m_Flags & HasValueFlag) != 0;
+    }
+  };
+
+  struct TBinaryReferenceRecord {
+    TRelationRole m_Role;
+    uint32_t m_Hint;
+    uint64_t m_Component;
+  };
+
+  struct TBinaryRelationRecord {
+    TRelationType m_Type;
+    std::optional<uint32_t> m_Order;
+    uint64_t m_ReferenceCount;
+    uint64_t m_ReferenceTable;
+  };
+
+  struct TBinaryLoadComponentRecord {
+    uint64_t m_Component;
+    uint64_t m_AttributeCount;
+    uint64_t m_AttributeTable;
+  };
+
+
+  class TBinaryDocument
+  {
+  public:
+    TBinaryDocument(const uint8_t* buffer, size_t size);
+
+    template<typename T>
+    [[nodiscard]] T read(uint64_t offset) const;
+
+    template<typename T>
+    [[nodiscard]] std::vector<T> readArray(uint64_t offset, uint64_t count) const;
+
+    template<typename T>
+    [[nodiscard]] const T* view(uint64_t offset, uint64_t count) const;
+
+    [[nodiscard]] const uint8_t* data(uint64_t offset, uint64_t size) const;
+
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] uint64_t getSection(TSection section) const
+    {
+      return m_Sections[static_cast<size_t>(section)];
+    }
+
+    [[nodiscard]] uint64_t getStringCount() const
+    {
+      return m_StringCount;
+    }
+
+    [[nodiscard]] std::string_view getString(uint32_t index) const;
+
+    [[nodiscard]] TModelInfo getInfo() const;
+
+    [[nodiscard]] uint64_t getTableSize(uint64_t table) const;
+
+    [[nodiscard]] uint64_t getTableEntry(uint64_t table, uint64_t index) const;
+
+    [[nodiscard]] uint64_t getComponentCount() const
+    {
+      return getTableSize(getSection(TSection::COMPONENTS));
+    }
+
+    [[nodiscard]] TBinaryComponentRecord getComponent(uint64_t index) const;
+
+    [[nodiscard]] TBinaryAttributeRecord getAttribute(uint64_t attributeTable, uint64_t index) const;
+
+    [[nodiscard]] uint64_t getRelationCount() const
+    {
+      return getTableSize(getSection(TSection::RELATIONS));
+    }
+
+    [[nodiscard]] TBinaryRelationRecord getRelation(uint64_t index) const;
+
+    [[nodiscard]] TBinaryReferenceRecord getReference(const TBinaryRelationRecord& relation, uint64_t index) const;
+
+    [[nodiscard]] uint64_t getLoadCaseCount() const;
+
+    [[nodiscard]] uint64_t getLoadCase(uint64_t index) const;
+
+    [[nodiscard]] std::optional<uint64_t> getAccumulation() const;
+
+    [[nodiscard]] uint64_t getLoadComponentCount(uint64_t loadComponents) const
+    {
+      return getTableSize(loadComponents);
+    }
+
+    [[nodiscard]] TBinaryLoadComponentRecord getLoadComponent(uint64_t loadComponents, uint64_t index) const;
+
+    [[nodiscard]] TValue getValue(const TBinaryAttributeRecord& attribute) const;
+
+  private:
+    const uint8_t* m_Data;
+    uint64_t m_Size;
+    std::array<uint64_t, 5> m_Sections{};
+    uint64_t m_StringCount{0};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  namespace detail
+  {
+    template<typename T>
+    struct TUnsigned;
+
+    template<>
+    struct TUnsigned<uint8_t> {
+      using Type = uint8_t;
+    };
+
+    template<>
+    struct TUnsigned<uint16_t> {
+      using Type = uint16_t;
+    };
+
+    template<>
+    struct TUnsigned<uint32_t> {
+      using Type = uint32_t;
+    };
+
+    template<>
+    struct TUnsigned<uint64_t> {
+      using Type = uint64_t;
+    };
+
+    template<>
+    struct TUnsigned<int64_t> {
+      using Type = uint64_t;
+    };
+
+    template<>
+    struct TUnsigned<double> {
+      using Type = uint64_t;
+    };
+
+    template<typename T>
+    static inline void encode(uint8_t* out, T value)
+    {
+      using U = typename TUnsigned<T>::Type;
+      U bits;
+      ::memcpy(&bits, &value, sizeof(U));
+      for (size_t n = 0; n < sizeof(U); ++n) {
+        out[n] = static_cast<uint8_t>(bits >> (8 * n));
+      }
+    }
+
+    template<typename T>
+    static inline T decode(const uint8_t* in)
+    {
+      using U = typename TUnsigned<T>::Type;
+      U bits{0};
+      for (size_t n = 0; n < sizeof(U); ++n) {
+        bits = static_cast<U>(bits | static_cast<U>(static_cast<U>(in[n]) << (8 * n)));
+      }
+      T value;
+      ::memcpy(&value, &bits, sizeof(U));
+      return value;
+    }
+  }
+
+  inline TBinaryWriter::TBinaryWriter()
+  {
+    m_Buffer.insert(m_Buffer.end(), Magic.begin(), Magic.end());
+    write<uint32_t>(FormatVersion);
+    write<uint32_t>(0);
+    reserve(HeaderSize - m_Buffer.size());
+  }
+
+  template<typename T>
+  inline void TBinaryWriter::write(T value)
+  {
+    const auto offset = m_Buffer.size();
+    m_Buffer.resize(offset + sizeof(T));
+    detail::encode(m_Buffer.data() + offset, value);
+  }
+
+  template<typename T>
+  inline void TBinaryWriter::writeAt(uint64_t offset, T value)
+  {
+    detail::encode(m_Buffer.data() + offset, value);
+  }
+
+  template<typename T>
+  inline void TBinaryWriter::writeArray(const T* values, size_t count)
+  {
+    if (isLittleEndian()) {
+      const auto offset = m_Buffer.size();
+      m_Buffer.resize(offset + count * sizeof(T));
+      if (count) {
+        ::memcpy(m_Buffer.data() + offset, values, count * sizeof(T));
+      }
+    } else {
+      for (size_t n = 0; n < count; ++n) {
+        write<T>(values[n]);
+      }
+    }
+  }
+
+  inline uint64_t TBinaryWriter::reserve(uint64_t size)
+  {
+    const auto offset = m_Buffer.size();
+    m_Buffer.resize(offset + size, 0);
+    return offset;
+  }
+
+  inline void TBinaryWriter::align()
+  {
+    m_Buffer.resize((m_Buffer.size() + 7) & ~static_cast<size_t>(7), 0);
+  }
+
+  inline uint32_t TBinaryWriter::intern(const std::string& s)
+  {
+    const auto it = m_StringIndex.find(s);
+    if (it != m_StringIndex.end()) {
+      return it->second;
+    }
+    const auto index = static_cast<uint32_t>(m_Strings.size());
+    m_Strings.emplace_back(&s);
+    m_StringIndex.emplace(s, index);
+    return index;
+  }
+
+  inline void TBinaryWriter::setSection(TSection section, uint64_t offset)
+  {
+    writeAt<uint64_t>(16 + 8 * static_cast<uint64_t>(section), offset);
+  }
+
+  inline std::vector<uint8_t> TBinaryWriter::release()
+  {
+    align();
+    setSection(TSection::STRINGS, position());
+    write<uint64_t>(m_Strings.size());
+    auto table = reserve(16 * m_Strings.size());
+    for (const auto* s : m_Strings) {
+      writeAt<uint64_t>(table, position());
+      writeAt<uint64_t>(table + 8, s->size());
+      m_Buffer.insert(m_Buffer.end(), s->begin(), s->end());
+      table += 16;
+    }
+    m_Strings.clear();
+    m_StringIndex.clear();
+    return std::move(m_Buffer);
+  }
+
+
+  inline TBinaryDocument::TBinaryDocument(const uint8_t* buffer, size_t size)
+  : m_Data{buffer}
+  , m_Size{size}
+  {
+    if (m_Size < HeaderSize || ::memcmp(m_Data, Magic.data(), Magic.size()) != 0) {
+      throw TException{"not a binary rexs document"};
+    }
+    if (const auto version = read<uint32_t>(8); version != FormatVersion) {
+      throw TException{fmt::format("unsupported binary rexs format version {}", version)};
+    }
+    for (size_t n = 0; n < m_Sections.size(); ++n) {
+      m_Sections[n] = read<uint64_t>(16 + 8 * n);
+    }
+    m_StringCount = read<uint64_t>(getSection(TSection::STRINGS));
+    if (m_StringCount > m_Size / 16) {
+      throw TException{"binary rexs document has a corrupt string table"};
+    }
+    static_cast<void>(data(getSection(TSection::STRINGS) + 8, 16 * m_StringCount));
+  }
+
+  template<typename T>
+  inline T TBinaryDocument::read(uint64_t offset) const
+  {
+    return detail::decode<T>(data(offset, sizeof(T)));
+  }
+
+  template<typename T>
+  inline std::vector<T> TBinaryDocument::readArray(uint64_t offset, uint64_t count) const
+  {
+    if (count > m_Size / sizeof(T)) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    const auto* p = data(offset, count * sizeof(T));
+    std::vector<T> values(count);
+    if (isLittleEndian()) {
+      if (count) {
+        ::memcpy(values.data(), p, count * sizeof(T));
+      }
+    } else {
+      for (uint64_t n = 0; n < count; ++n) {
+        values[n] = detail::decode<T>(p + n * sizeof(T));
+      }
+    }
+    return values;
+  }
+
+  template<typename T>
+  inline const T* TBinaryDocument::view(uint64_t offset, uint64_t count) const
+  {
+    if (!isLittleEndian()) {
+      throw TException{"in place access to binary rexs documents needs a little-endian host"};
+    }
+    if (count > m_Size / sizeof(T)) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    const auto* p = data(offset, count * sizeof(T));
+    if (reinterpret_cast<uintptr_t>(p) % alignof(T) != 0) {
+      throw TException{fmt::format("binary rexs document is not aligned at offset {}", offset)};
+    }
+    return reinterpret_cast<const T*>(p);
+  }
+
+  inline const uint8_t* TBinaryDocument::data(uint64_t offset, uint64_t size) const
+  {
+    if (offset > m_Size || size > m_Size - offset) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    return m_Data + offset;
+  }
+
+  inline std::string_view TBinaryDocument::getString(uint32_t index) const
+  {
+    if (index >= m_StringCount) {
+      throw TException{fmt::format("binary rexs document has no string {}", index)};
+    }
+    const auto entry = getSection(TSection::STRINGS) + 8 + 16 * static_cast<uint64_t>(index);
+    const auto offset = read<uint64_t>(entry);
+    const auto size = read<uint64_t>(entry + 8);
+    return std::string_view{reinterpret_cast<const char*>(data(offset, size)), size};
+  }
+
+  inline TModelInfo TBinaryDocument::getInfo() const
+  {
+    const auto info = getSection(TSection::INFO);
+    std::optional<std::string> language;
+    if (read<uint8_t>(info + 20)) {
+      language = std::string{getString(read<uint32_t>(info + 24))};
+    }
+    return TModelInfo{std::string{getString(read<uint32_t>(info))}, std::string{getString(read<uint32_t>(info + 4))},
+                      std::string{getString(read<uint32_t>(info + 8))},
+                      TRexsVersion{read<uint32_t>(info + 12), read<uint32_t>(info + 16)}, language};
+  }
+
+  inline uint64_t TBinaryDocument::getTableSize(uint64_t table) const
+  {
+    const auto count = read<uint64_t>(table);
+    if (count > m_Size / 8) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", table)};
+    }
+    static_cast<void>(data(table + 8, 8 * count));
+    return count;
+  }
+
+  inline uint64_t TBinaryDocument::getTableEntry(uint64_t table, uint64_t index) const
+  {
+    if (index >= read<uint64_t>(table)) {
+      throw TException{fmt::format("binary rexs document has no entry {} at offset {}", index, table)};
+    }
+    return read<uint64_t>(table + 8 + 8 * index);
+  }
+
+  inline TBinaryComponentRecord TBinaryDocument::getComponent(uint64_t index) const
+  {
+    const auto offset = getTableEntry(getSection(TSection::COMPONENTS), index);
+    return TBinaryComponentRecord{read<uint64_t>(offset), read<uint32_t>(offset + 8), read<uint32_t>(offset + 12),
+                                  read<uint64_t>(offset + 16), offset + 16};
+  }
+
+  inline TBinaryAttributeRecord TBinaryDocument::getAttribute(uint64_t attributeTable, uint64_t index) const
+  {
+    const auto offset = getTableEntry(attributeTable, index);
+    const auto type = read<uint8_t>(offset + 8);
+    const auto codeType = read<uint8_t>(offset + 10);
+    if (type > static_cast<uint8_t>(TValueType::ARRAY_OF_INTEGER_ARRAYS) ||
+        codeType > static_cast<uint8_t>(TCodeType::Optimized)) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    return TBinaryAttributeRecord{read<uint32_t>(offset),
+                                  read<uint32_t>(offset + 4),
+                                  static_cast<TValueType>(type),
+                                  read<uint8_t>(offset + 9),
+                                  static_cast<TCodeType>(codeType),
+                                  offset + AttributeHeaderSize};
+  }
+
+  inline TBinaryRelationRecord TBinaryDocument::getRelation(uint64_t index) const
+  {
+    const auto offset = getTableEntry(getSection(TSection::RELATIONS), index);
+    const auto type = read<uint8_t>(offset);
+    if (type > static_cast<uint8_t>(TRelationType::STAGE_GEAR_DATA)) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    std::optional<uint32_t> order;
+    if (read<uint8_t>(offset + 1)) {
+      order = read<uint32_t>(offset + 4);
+    }
+    const auto count = read<uint64_t>(offset + 8);
+    if (count > m_Size / ReferenceSize) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    static_cast<void>(data(offset + 16, ReferenceSize * count));
+    return TBinaryRelationRecord{static_cast<TRelationType>(type), order, count, offset + 16};
+  }
+
+  inline TBinaryReferenceRecord TBinaryDocument::getReference(const TBinaryRelationRecord& relation,
+                                                              uint64_t index) const
+  {
+    if (index >= relation.m_ReferenceCount) {
+      throw TException{fmt::format("binary rexs relation has no reference {}", index)};
+    }
+    const auto offset = relation.m_ReferenceTable + ReferenceSize * index;
+    const auto role = read<uint8_t>(offset);
+    if (role > static_cast<uint8_t>(TRelationRole::WORKPIECE)) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+    }
+    return TBinaryReferenceRecord{static_cast<TRelationRole>(role), read<uint32_t>(offset + 4),
+                                  read<uint64_t>(offset + 8)};
+  }
+
+  inline uint64_t TBinaryDocument::getLoadCaseCount() const
+  {
+    const auto spectrum = getSection(TSection::SPECTRUM);
+    const auto count = read<uint64_t>(spectrum);
+    if (count > m_Size / 8) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", spectrum)};
+    }
+    static_cast<void>(data(spectrum + 16, 8 * count));
+    return count;
+  }
+
+  inline uint64_t TBinaryDocument::getLoadCase(uint64_t index) const
+  {
+    const auto spectrum = getSection(TSection::SPECTRUM);
+    if (index >= read<uint64_t>(spectrum)) {
+      throw TException{fmt::format("binary rexs document has no load case {}", index)};
+    }
+    return read<uint64_t>(spectrum + 16 + 8 * index);
+  }
+
+  inline std::optional<uint64_t> TBinaryDocument::getAccumulation() const
+  {
+    const auto offset = read<uint64_t>(getSection(TSection::SPECTRUM) + 8);
+    if (offset == 0) {
+      return {};
+    }
+    return offset;
+  }
+
+  inline TBinaryLoadComponentRecord TBinaryDocument::getLoadComponent(uint64_t loadComponents, uint64_t index) const
+  {
+    const auto offset = getTableEntry(loadComponents, index);
+    return TBinaryLoadComponentRecord{read<uint64_t>(offset), read<uint64_t>(offset + 8), offset + 8};
+  }
+
+  inline TValue TBinaryDocument::getValue(const TBinaryAttributeRecord& attribute) const
+  {
+    if (!attribute.hasValue()) {
+      return TValue{};
+    }
+
+    const auto offset = attribute.m_Payload;
+    TValue value;
+    switch (attribute.m_Type) {
+      case TValueType::FLOATING_POINT:
+        value = TValue{read<double>(offset)};
+        break;
+      case TValueType::BOOLEAN:
+        value = TValue{read<uint8_t>(offset) != 0};
+        break;
+      case TValueType::INTEGER:
+      case TValueType::REFERENCE_COMPONENT:
+        value = TValue{read<int64_t>(offset)};
+        break;
+      case TValueType::ENUM:
+      case TValueType::STRING:
+      case TValueType::FILE_REFERENCE:
+        value = TValue{std::string{getString(read<uint32_t>(offset))}};
+        break;
+      case TValueType::FLOATING_POINT_ARRAY:
+        value = TValue{readArray<double>(offset + 8, read<uint64_t>(offset))};
+        break;
+      case TValueType::INTEGER_ARRAY:
+        value = TValue{readArray<int64_t>(offset + 8, read<uint64_t>(offset))};
+        break;
+      case TValueType::BOOLEAN_ARRAY: {
+        const auto bytes = readArray<uint8_t>(offset + 8, read<uint64_t>(offset));
+        value = TValue{std::vector<Bool>(bytes.begin(), bytes.end())};
+        break;
+      }
+      case TValueType::ENUM_ARRAY:
+      case TValueType::STRING_ARRAY: {
+        const auto indices = readArray<uint32_t>(offset + 8, read<uint64_t>(offset));
+        std::vector<std::string> strings;
+        strings.reserve(indices.size());
+        for (const auto index : indices) {
+          strings.emplace_back(getString(index));
+        }
+        value = TValue{std::move(strings)};
+        break;
+      }
+      case TValueType::FLOATING_POINT_MATRIX: {
+        const auto rows = read<uint64_t>(offset);
+        const auto columns = read<uint64_t>(offset + 8);
+        if (rows > m_Size || (columns && rows > m_Size / columns)) {
+          throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+        }
+        const auto values = readArray<double>(offset + 16, rows * columns);
+        TMatrix<double> matrix;
+        matrix.m_Values.reserve(rows);
+        for (uint64_t row = 0; row < rows; ++row) {
+          matrix.m_Values.emplace_back(values.begin() + static_cast<std::ptrdiff_t>(row * columns),
+                                       values.begin() + static_cast<std::ptrdiff_t>((row + 1) * columns));
+        }
+        value = TValue{std::move(matrix)};
+        break;
+      }
+      case TValueType::STRING_MATRIX: {
+        const auto rows = read<uint64_t>(offset);
+        const auto columns = read<uint64_t>(offset + 8);
+        if (rows > m_Size || (columns && rows > m_Size / columns)) {
+          throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+        }
+        const auto indices = readArray<uint32_t>(offset + 16, rows * columns);
+        TMatrix<std::string> matrix;
+        matrix.m_Values.resize(rows);
+        for (uint64_t row = 0; row < rows; ++row) {
+          matrix.m_Values[row].reserve(columns);
+          for (uint64_t column = 0; column < columns; ++column) {
+            matrix.m_Values[row].emplace_back(getString(indices[row * columns + column]));
+          }
+        }
+        value = TValue{std::move(matrix)};
+        break;
+      }
+      case TValueType::ARRAY_OF_INTEGER_ARRAYS: {
+        const auto count = read<uint64_t>(offset);
+        if (count > m_Size / 8) {
+          throw TException{fmt::format("binary rexs document is corrupt at offset {}", offset)};
+        }
+        std::vector<std::vector<int64_t>> arrays;
+        arrays.reserve(count);
+        auto current = offset + 8;
+        for (uint64_t n = 0; n < count; ++n) {
+          const auto size = read<uint64_t>(current);
+          arrays.emplace_back(readArray<int64_t>(current + 8, size));
+          current += 8 + 8 * size;
+        }
+        value = TValue{std::move(arrays)};
+        break;
+      }
+    }
+    value.coded(attribute.m_CodeType);
+    return value;
+  }
+}
+
+#endif
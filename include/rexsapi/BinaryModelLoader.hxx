@@ -0,0 +1,287 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_BINARY_MODEL_LOADER_HXX
+#define REXSAPI_BINARY_MODEL_LOADER_HXX
+
+#include <rexsapi/BinaryFormat.hxx>
+#include <rexsapi/Mode.hxx>
+#include <rexsapi/ModelHelper.hxx>
+#include <rexsapi/Result.hxx>
+#include <rexsapi/database/ModelRegistry.hxx>
+
+namespace rexsapi
+{
+  namespace binary
+  {
+    /**
+     * @brief Value decoder for the TModelHelper checks of binary documents.
+     *
+     * The values of a binary document are already decoded, so only enum values are checked against the database model.
+     */
+    class TBinaryValueDecoder
+    {
+    public:
+      [[nodiscard]] std::pair<TValue, bool> decode(TValueType type,
+                                                   const std::optional<const database::TEnumValues>& enumValue,
+                                                   const TValue& value) const;
+    };
+  }
+
+
+  class TBinaryModelLoader
+  {
+  public:
+    explicit TBinaryModelLoader(TMode mode)
+    : m_Mode{mode}
+    , m_LoaderHelper{mode}
+    {
+    }
+
+    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry,
+                               const std::vector<uint8_t>& buffer) const;
+
+    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry, const uint8_t* data,
+                               size_t size) const;
+
+  private:
+    /// Maps the component indices of the document to the loaded components, nullptr for rejected components
+    using TComponentTable = std::vector<const TComponent*>;
+
+    TComponents getComponents(TResult& result, const binary::TBinaryDocument& doc, const database::TModel& dbModel,
+                              std::vector<std::optional<size_t>>& positions) const;
+
+    TAttributes getAttributes(std::string_view context, TResult& result, const binary::TBinaryDocument& doc,
+                              uint64_t componentId, const database::TComponent& componentType,
+                              uint64_t attributeTable) const;
+
+    TRelations getRelations(TResult& result, const binary::TBinaryDocument& doc,
+                            const TComponentTable& componentTable) const;
+
+    TLoadComponents getLoadComponents(std::string_view context, TResult& result, const binary::TBinaryDocument& doc,
+                                      const database::TModel& dbModel, const TComponentTable& componentTable,
+                                      uint64_t table) const;
+
+    TModeAdapter m_Mode;
+    TModelHelper<binary::TBinaryValueDecoder> m_LoaderHelper;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  namespace binary
+  {
+    inline std::pair<TValue, bool>
+    TBinaryValueDecoder::decode(TValueType type, const std::optional<const database::TEnumValues>& enumValue,
+                                const TValue& value) const
+    {
+      if (type == TValueType::ENUM) {
+        return std::make_pair(value, enumValue && enumValue->check(value.getValue<TEnumType>()));
+      }
+      if (type == TValueType::ENUM_ARRAY) {
+        const auto& values = value.getValue<TEnumArrayType>();
+        const bool valid = enumValue && std::all_of(values.begin(), values.end(), [&enumValue](const auto& v) {
+                             return enumValue->check(v);
+                           });
+        return std::make_pair(value, valid);
+      }
+      return std::make_pair(value, true);
+    }
+  }
+
+  inline std::optional<TModel> TBinaryModelLoader::load(TResult& result, const database::TModelRegistry& registry,
+                                                        const std::vector<uint8_t>& buffer) const
+  {
+    return load(result, registry, buffer.data(), buffer.size());
+  }
+
+  inline std::optional<TModel> TBinaryModelLoader::load(TResult& result, const database::TModelRegistry& registry,
+                                                        const uint8_t* data, size_t size) const
+  {
+    try {
+      const binary::TBinaryDocument doc{data, size};
+
+      TModelInfo modelInfo = doc.getInfo();
+      const auto& dbModel = registry.getModel(modelInfo.getVersion(), "en");
+
+      std::vector<std::optional<size_t>> positions;
+      TComponents components = getComponents(result, doc, dbModel, positions);
+      // reference attributes store internal ids, references to rejected or unknown components are removed
+      ComponentMapping componentMapping;
+      for (const auto& component : components) {
+        componentMapping.mapComponent(component.getInternalId(), component.getInternalId());
+      }
+      ComponentPostProcessor postProcessor{result, m_Mode, std::move(components), componentMapping};
+      components = postProcessor.release();
+      TComponentTable componentTable;
+      componentTable.reserve(positions.size());
+      for (const auto& position : positions) {
+        componentTable.emplace_back(position ? &components[*position] : nullptr);
+      }
+      TRelations relations = getRelations(result, doc, componentTable);
+
+      TLoadCases loadCases;
+      const auto loadCaseCount = doc.getLoadCaseCount();
+      loadCases.reserve(loadCaseCount);
+      for (uint64_t n = 0; n < loadCaseCount; ++n) {
+        loadCases.emplace_back(getLoadComponents(fmt::format("load_case id={}", n + 1), result, doc, dbModel,
+                                                 componentTable, doc.getLoadCase(n)));
+      }
+      std::optional<TAccumulation> accumulation;
+      if (const auto offset = doc.getAccumulation(); offset.has_value()) {
+        accumulation = TAccumulation{getLoadComponents("accumulation", result, doc, dbModel, componentTable, *offset)};
+      }
+
+      return TModel{std::move(modelInfo), std::move(components), std::move(relations),
+                    TLoadSpectrum{std::move(loadCases), std::move(accumulation)}};
+    } catch (const std::exception& ex) {
+      result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot load binary document: {}", ex.what())});
+    }
+    return {};
+  }
+
+  inline TComponents TBinaryModelLoader::getComponents(TResult& result, const binary::TBinaryDocument& doc,
+                                                       const database::TModel& dbModel,
+                                                       std::vector<std::optional<size_t>>& positions) const
+  {
+    TComponents components;
+    const auto count = doc.getComponentCount();
+    components.reserve(count);
+    positions.reserve(count);
+
+    for (uint64_t n = 0; n < count; ++n) {
+      const auto record = doc.getComponent(n);
+      positions.emplace_back();
+      try {
+        const auto& componentType = dbModel.findComponentById(std::string{doc.getString(record.m_Type)});
+        std::string name{doc.getString(record.m_Name)};
+        std::string context = name.empty() ? componentType.getName() : name;
+        TAttributes attributes =
+          getAttributes(context, result, doc, record.m_InternalId, componentType, record.m_AttributeTable);
+        positions.back() = components.size();
+        components.emplace_back(record.m_InternalId, componentType.getComponentId(), std::move(name),
+                                std::move(attributes));
+      } catch (const std::exception& ex) {
+        result.addError(
+          TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", record.m_InternalId, ex.what())});
+      }
+    }
+
+    return components;
+  }
+
+  inline TAttributes TBinaryModelLoader::getAttributes(std::string_view context, TResult& result,
+                                                       const binary::TBinaryDocument& doc, uint64_t componentId,
+                                                       const database::TComponent& componentType,
+                                                       uint64_t attributeTable) const
+  {
+    TAttributes attributes;
+    const auto count = doc.getTableSize(attributeTable);
+    attributes.reserve(count);
+
+    for (uint64_t n = 0; n < count; ++n) {
+      const auto record = doc.getAttribute(attributeTable, n);
+      std::string id{doc.getString(record.m_Id)};
+      std::string unit{doc.getString(record.m_Unit)};
+      auto value = doc.getValue(record);
+
+      bool isCustom = m_LoaderHelper.checkCustom(result, context, id, componentId, componentType);
+
+      if (!isCustom) {
+        const auto& att = componentType.findAttributeById(id);
+        if (!unit.empty() && TUnit{unit} != att.getUnit()) {
+          result.addError(
+            TError{m_Mode.adapt(TErrorLevel::WARN),
+                   fmt::format("{}: specified incorrect unit ({}) for attribute id={}", context, unit, id)});
+        }
+        if (record.m_Type != att.getValueType()) {
+          result.addError(TError{
+            m_Mode.adapt(TErrorLevel::WARN),
+            fmt::format("{}: specified incorrect type ({}) for attribute id={}", context, toTypeString(record.m_Type), id)});
+          value = TValue{};
+        } else if (record.hasValue()) {
+          value = m_LoaderHelper.getValue(result, context, id, componentId, att, value);
+        }
+        attributes.emplace_back(TAttribute{att, TUnit{att.getUnit()}, std::move(value)});
+      } else {
+        if (record.hasValue()) {
+          value = m_LoaderHelper.getValue(result, record.m_Type, context, id, componentId, value);
+        }
+        attributes.emplace_back(TAttribute{std::move(id), TUnit{std::move(unit)}, record.m_Type, std::move(value)});
+      }
+    }
+
+    return attributes;
+  }
+
+  inline TRelations TBinaryModelLoader::getRelations(TResult& result, const binary::TBinaryDocument& doc,
+                                                     const TComponentTable& componentTable) const
+  {
+    TRelations relations;
+    const auto count = doc.getRelationCount();
+    relations.reserve(count);
+
+    for (uint64_t n = 0; n < count; ++n) {
+      const auto record = doc.getRelation(n);
+      TRelationReferences references;
+      references.reserve(record.m_ReferenceCount);
+      for (uint64_t r = 0; r < record.m_ReferenceCount; ++r) {
+        const auto reference = doc.getReference(record, r);
+        if (reference.m_Component >= componentTable.size() || componentTable[reference.m_Component] == nullptr) {
+          result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                                 fmt::format("relation {} referenced component {} does not exist", n + 1,
+                                             reference.m_Component)});
+          continue;
+        }
+        references.emplace_back(TRelationReference{reference.m_Role, std::string{doc.getString(reference.m_Hint)},
+                                                   *componentTable[reference.m_Component]});
+      }
+      relations.emplace_back(TRelation{record.m_Type, record.m_Order, std::move(references)});
+    }
+
+    return relations;
+  }
+
+  inline TLoadComponents TBinaryModelLoader::getLoadComponents(std::string_view context, TResult& result,
+                                                               const binary::TBinaryDocument& doc,
+                                                               const database::TModel& dbModel,
+                                                               const TComponentTable& componentTable,
+                                                               uint64_t table) const
+  {
+    TLoadComponents loadComponents;
+    const auto count = doc.getLoadComponentCount(table);
+    loadComponents.reserve(count);
+
+    for (uint64_t n = 0; n < count; ++n) {
+      const auto record = doc.getLoadComponent(table, n);
+      if (record.m_Component >= componentTable.size() || componentTable[record.m_Component] == nullptr) {
+        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                               fmt::format("{} component {} does not exist", context, record.m_Component)});
+        continue;
+      }
+      const auto& component = *componentTable[record.m_Component];
+      TAttributes attributes = getAttributes(context, result, doc, component.getInternalId(),
+                                             dbModel.findComponentById(component.getType()), record.m_AttributeTable);
+      loadComponents.emplace_back(TLoadComponent{component, std::move(attributes)});
+    }
+
+    return loadComponents;
+  }
+}
+
+#endif
@@ -0,0 +1,293 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_BINARY_MODEL_SERIALIZER_HXX
+#define REXSAPI_BINARY_MODEL_SERIALIZER_HXX
+
+#include <rexsapi/BinaryFormat.hxx>
+#include <rexsapi/Model.hxx>
+
+namespace rexsapi
+{
+  class BinaryModelSerializer
+  {
+  public:
+    template<typename TSerializer>
+    void serialize(const TModel& model, TSerializer& serializer);
+
+  private:
+    void serialize(binary::TBinaryWriter& writer, const TModelInfo& info) const;
+    void serialize(binary::TBinaryWriter& writer, const TComponents& components) const;
+    void serialize(binary::TBinaryWriter& writer, const TAttributes& attributes) const;
+    void serialize(binary::TBinaryWriter& writer, const TAttribute& attribute) const;
+    void serialize(binary::TBinaryWriter& writer, const TRelations& relations) const;
+    void serialize(binary::TBinaryWriter& writer, const TLoadSpectrum& spectrum) const;
+    void serialize(binary::TBinaryWriter& writer, const TLoadComponents& components) const;
+
+    uint64_t getComponentIndex(const TComponent& component) const;
+
+    std::unordered_map<uint64_t, uint64_t> m_ComponentIndex;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  template<typename TSerializer>
+  inline void BinaryModelSerializer::serialize(const TModel& model, TSerializer& serializer)
+  {
+    m_ComponentIndex.clear();
+    for (const auto& component : model.getComponents()) {
+      m_ComponentIndex.emplace(component.getInternalId(), m_ComponentIndex.size());
+    }
+
+    binary::TBinaryWriter writer;
+    serialize(writer, model.getInfo());
+    serialize(writer, model.getComponents());
+    serialize(writer, model.getRelations());
+    serialize(writer, model.getLoadSpectrum());
+
+    serializer.serialize(writer.release());
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TModelInfo& info) const
+  {
+    writer.align();
+    writer.setSection(binary::TSection::INFO, writer.position());
+    writer.write<uint32_t>(writer.intern(info.getApplicationId()));
+    writer.write<uint32_t>(writer.intern(info.getApplicationVersion()));
+    writer.write<uint32_t>(writer.intern(info.getDate()));
+    writer.write<uint32_t>(info.getVersion().getMajor());
+    writer.write<uint32_t>(info.getVersion().getMinor());
+    writer.write<uint8_t>(info.getApplicationLanguage().has_value() ? 1 : 0);
+    writer.reserve(3);
+    writer.write<uint32_t>(info.getApplicationLanguage().has_value() ? writer.intern(*info.getApplicationLanguage()) : 0);
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TComponents& components) const
+  {
+    writer.align();
+    writer.setSection(binary::TSection::COMPONENTS, writer.position());
+    writer.write<uint64_t>(components.size());
+    auto table = writer.reserve(8 * components.size());
+
+    for (const auto& component : components) {
+      writer.align();
+      writer.writeAt<uint64_t>(table, writer.position());
+      table += 8;
+      writer.write<uint64_t>(component.getInternalId());
+      writer.write<uint32_t>(writer.intern(component.getType()));
+      writer.write<uint32_t>(writer.intern(component.getName()));
+      serialize(writer, component.getAttributes());
+    }
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TAttributes& attributes) const
+  {
+    writer.write<uint64_t>(attributes.size());
+    auto table = writer.reserve(8 * attributes.size());
+
+    for (const auto& attribute : attributes) {
+      writer.align();
+      writer.writeAt<uint64_t>(table, writer.position());
+      table += 8;
+      serialize(writer, attribute);
+    }
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TAttribute& attribute) const
+  {
+    const auto type = attribute.getValueType();
+    uint8_t flags = attribute.isCustomAttribute() ? binary::CustomAttributeFlag : 0;
+    if (attribute.hasValue()) {
+      flags = static_cast<uint8_t>(flags | binary::HasValueFlag);
+    }
+    writer.write<uint32_t>(writer.intern(attribute.getAttributeId()));
+    writer.write<uint32_t>(writer.intern(attribute.getUnit().getName()));
+    writer.write<uint8_t>(static_cast<uint8_t>(type));
+    writer.write<uint8_t>(flags);
+    writer.write<uint8_t>(static_cast<uint8_t>(attribute.getValue().coded()));
+    writer.reserve(5);
+    if (!attribute.hasValue()) {
+      return;
+    }
+
+    const auto& value = attribute.getValue();
+    try {
+      switch (type) {
+        case TValueType::FLOATING_POINT:
+          writer.write<double>(value.getValue<TFloatType>());
+          break;
+        case TValueType::BOOLEAN:
+          writer.write<uint8_t>(value.getValue<TBoolType>() ? 1 : 0);
+          break;
+        case TValueType::INTEGER:
+          writer.write<int64_t>(value.getValue<TIntType>());
+          break;
+        case TValueType::REFERENCE_COMPONENT:
+          writer.write<int64_t>(value.getValue<TReferenceComponentType>());
+          break;
+        case TValueType::ENUM:
+        case TValueType::STRING:
+        case TValueType::FILE_REFERENCE:
+          writer.write<uint32_t>(writer.intern(value.getValue<TStringType>()));
+          break;
+        case TValueType::FLOATING_POINT_ARRAY: {
+          const auto& array = value.getValue<TFloatArrayType>();
+          writer.write<uint64_t>(array.size());
+          writer.writeArray(array.data(), array.size());
+          break;
+        }
+        case TValueType::INTEGER_ARRAY: {
+          const auto& array = value.getValue<TIntArrayType>();
+          writer.write<uint64_t>(array.size());
+          writer.writeArray(array.data(), array.size());
+          break;
+        }
+        case TValueType::BOOLEAN_ARRAY: {
+          const auto& array = value.getValue<TBoolArrayType>();
+          writer.write<uint64_t>(array.size());
+          for (const auto& b : array) {
+            writer.write<uint8_t>(b.m_Value ? 1 : 0);
+          }
+          break;
+        }
+        case TValueType::ENUM_ARRAY:
+        case TValueType::STRING_ARRAY: {
+          const auto& array = value.getValue<TStringArrayType>();
+          writer.write<uint64_t>(array.size());
+          for (const auto& s : array) {
+            writer.write<uint32_t>(writer.intern(s));
+          }
+          break;
+        }
+        case TValueType::FLOATING_POINT_MATRIX: {
+          const auto& matrix = value.getValue<TFloatMatrixType>();
+          if (!matrix.validate()) {
+            throw TException{"matrix rows have different sizes"};
+          }
+          writer.write<uint64_t>(matrix.m_Values.size());
+          writer.write<uint64_t>(matrix.m_Values.empty() ? 0 : matrix.m_Values[0].size());
+          for (const auto& row : matrix.m_Values) {
+            writer.writeArray(row.data(), row.size());
+          }
+          break;
+        }
+        case TValueType::STRING_MATRIX: {
+          const auto& matrix = value.getValue<TStringMatrixType>();
+          if (!matrix.validate()) {
+            throw TException{"matrix rows have different sizes"};
+          }
+          writer.write<uint64_t>(matrix.m_Values.size());
+          writer.write<uint64_t>(matrix.m_Values.empty() ? 0 : matrix.m_Values[0].size());
+          for (const auto& row : matrix.m_Values) {
+            for (const auto& s : row) {
+              writer.write<uint32_t>(writer.intern(s));
+            }
+          }
+          break;
+        }
+        case TValueType::ARRAY_OF_INTEGER_ARRAYS: {
+          const auto& arrays = value.getValue<TArrayOfIntArraysType>();
+          writer.write<uint64_t>(arrays.size());
+          for (const auto& array : arrays) {
+            writer.write<uint64_t>(array.size());
+            writer.writeArray(array.data(), array.size());
+          }
+          break;
+        }
+      }
+    } catch (const std::bad_variant_access&) {
+      throw TException{fmt::format("attribute id={} has wrong value for type {}", attribute.getAttributeId(),
+                                   toTypeString(type))};
+    } catch (const TException& ex) {
+      throw TException{fmt::format("attribute id={}: {}", attribute.getAttributeId(), ex.what())};
+    }
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TRelations& relations) const
+  {
+    writer.align();
+    writer.setSection(binary::TSection::RELATIONS, writer.position());
+    writer.write<uint64_t>(relations.size());
+    auto table = writer.reserve(8 * relations.size());
+
+    for (const auto& relation : relations) {
+      writer.align();
+      writer.writeAt<uint64_t>(table, writer.position());
+      table += 8;
+      writer.write<uint8_t>(static_cast<uint8_t>(relation.getType()));
+      writer.write<uint8_t>(relation.getOrder().has_value() ? 1 : 0);
+      writer.reserve(2);
+      writer.write<uint32_t>(relation.getOrder().value_or(0));
+      writer.write<uint64_t>(relation.getReferences().size());
+      for (const auto& reference : relation.getReferences()) {
+        writer.write<uint8_t>(static_cast<uint8_t>(reference.getRole()));
+        writer.reserve(3);
+        writer.write<uint32_t>(writer.intern(reference.getHint()));
+        writer.write<uint64_t>(getComponentIndex(reference.getComponent()));
+      }
+    }
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TLoadSpectrum& spectrum) const
+  {
+    writer.align();
+    const auto section = writer.position();
+    writer.setSection(binary::TSection::SPECTRUM, section);
+    writer.write<uint64_t>(spectrum.getLoadCases().size());
+    writer.write<uint64_t>(0);
+    auto table = writer.reserve(8 * spectrum.getLoadCases().size());
+
+    for (const auto& loadCase : spectrum.getLoadCases()) {
+      writer.align();
+      writer.writeAt<uint64_t>(table, writer.position());
+      table += 8;
+      serialize(writer, loadCase.getLoadComponents());
+    }
+    if (spectrum.hasAccumulation()) {
+      writer.align();
+      writer.writeAt<uint64_t>(section + 8, writer.position());
+      serialize(writer, spectrum.getAccumulation().getLoadComponents());
+    }
+  }
+
+  inline void BinaryModelSerializer::serialize(binary::TBinaryWriter& writer, const TLoadComponents& components) const
+  {
+    writer.write<uint64_t>(components.size());
+    auto table = writer.reserve(8 * components.size());
+
+    for (const auto& component : components) {
+      writer.align();
+      writer.writeAt<uint64_t>(table, writer.position());
+      table += 8;
+      writer.write<uint64_t>(getComponentIndex(component.getComponent()));
+      serialize(writer, component.getLoadAttributes());
+    }
+  }
+
+  inline uint64_t BinaryModelSerializer::getComponentIndex(const TComponent& component) const
+  {
+    const auto it = m_ComponentIndex.find(component.getInternalId());
+    if (it == m_ComponentIndex.end()) {
+      throw TException{fmt::format("component id={} is not part of the model", component.getInternalId())};
+    }
+    return it->second;
+  }
+}
+
+#endif
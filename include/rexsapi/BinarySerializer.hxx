@@ -0,0 +1,70 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_BINARY_SERIALIZER_HXX
+#define REXSAPI_BINARY_SERIALIZER_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace rexsapi
+{
+  class BinaryBufferSerializer
+  {
+  public:
+    void serialize(std::vector<uint8_t> doc)
+    {
+      m_Model = std::move(doc);
+    }
+
+    const std::vector<uint8_t>& getModel() const&
+    {
+      return m_Model;
+    }
+
+  private:
+    std::vector<uint8_t> m_Model;
+  };
+
+
+  class BinaryFileSerializer
+  {
+  public:
+    explicit BinaryFileSerializer(std::filesystem::path file)
+    : m_File{std::move(file)}
+    {
+    }
+
+    void serialize(const std::vector<uint8_t>& doc) const
+    {
+      std::ofstream stream{m_File, std::ios::binary | std::ios::out | std::ios::trunc};
+      stream.write(reinterpret_cast<const char*>(doc.data()), static_cast<std::streamsize>(doc.size()));
+      stream.flush();
+      if (!stream) {
+        throw TException{fmt::format("Could not serialize model to {}", m_File.string())};
+      }
+    }
+
+  private:
+    std::filesystem::path m_File;
+  };
+}
+
+#endif
@@ -19,6 +19,8 @@
 
 #include <rexsapi/Attribute.hxx>
 
+#include <iterator>
+
 namespace rexsapi
 {
   class TComponent
@@ -29,6 +31,7 @@ namespace rexsapi
     , m_Type{std::move(type)}
     , m_Name{std::move(name)}
     , m_Attributes{std::move(attributes)}
+    , m_Index{m_Attributes}
     {
     }
 
@@ -52,14 +55,138 @@ namespace rexsapi
       return m_Attributes;
     }
 
+    /// Returns the attribute with the id or nullptr, the lookup is a binary search in a sorted index
+    [[nodiscard]] const TAttribute* findAttribute(std::string_view attributeId) const
+    {
+      return m_Index.find(m_Attributes, attributeId);
+    }
+
+    /**
+     * @brief Returns the value of the attribute with the id.
+     *
+     * @throws TException if the component has no attribute with the id
+     */
+    template<typename T>
+    [[nodiscard]] const auto& getValue(std::string_view attributeId) const&
+    {
+      const auto* attribute = findAttribute(attributeId);
+      if (attribute == nullptr) {
+        throw TException{fmt::format("component id={} has no attribute id={}", m_InternalId, attributeId)};
+      }
+      return attribute->getValue<T>();
+    }
+
   private:
+    friend class ComponentPostProcessor;
+
     uint64_t m_InternalId;
     std::string m_Type;
     std::string m_Name;
     TAttributes m_Attributes;
+    detail::TAttributeIndex m_Index;
   };
 
   using TComponents = std::vector<TComponent>;
+
+
+  /**
+   * @brief Read-only range of components, as returned by the model queries.
+   *
+   * A range does not own its components and stays valid as long as the model it was returned from exists.
+   */
+  class TComponentRange
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = TComponent;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const TComponent*;
+      using reference = const TComponent&;
+
+      const_iterator() = default;
+
+      explicit const_iterator(const TComponent* const* it) noexcept
+      : m_It{it}
+      {
+      }
+
+      reference operator*() const noexcept
+      {
+        return **m_It;
+      }
+
+      pointer operator->() const noexcept
+      {
+        return *m_It;
+      }
+
+      const_iterator& operator++() noexcept
+      {
+        ++m_It;
+        return *this;
+      }
+
+      const_iterator operator++(int) noexcept
+      {
+        auto it = *this;
+        ++m_It;
+        return it;
+      }
+
+      bool operator==(const const_iterator& other) const noexcept
+      {
+        return m_It == other.m_It;
+      }
+
+      bool operator!=(const const_iterator& other) const noexcept
+      {
+        return m_It != other.m_It;
+      }
+
+    private:
+      const TComponent* const* m_It{nullptr};
+    };
+
+    TComponentRange() = default;
+
+    TComponentRange(const TComponent* const* components, size_t size) noexcept
+    : m_Components{components}
+    , m_Size{size}
+    {
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return m_Size == 0;
+    }
+
+    const TComponent& operator[](size_t index) const noexcept
+    {
+      return *m_Components[index];
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return const_iterator{m_Components};
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return const_iterator{m_Components + m_Size};
+    }
+
+  private:
+    const TComponent* const* m_Components{nullptr};
+    size_t m_Size{0};
+  };
 }
 
 #endif
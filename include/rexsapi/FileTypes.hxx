@@ -24,7 +24,7 @@
 
 namespace rexsapi
 {
-  enum class TFileType { UNKOWN, XML, JSON, COMPRESSED };
+  enum class TFileType { UNKOWN, XML, JSON, COMPRESSED, BINARY };
   TFileType fileTypeFromString(const std::string& type);
 
   class TExtensionChecker
@@ -46,6 +46,9 @@ namespace rexsapi
     if (rexsapi::toupper(type) == "JSON") {
       return TFileType::JSON;
     }
+    if (rexsapi::toupper(type) == "BINARY") {
+      return TFileType::BINARY;
+    }
 
     throw TException{fmt::format("unknown file type {}", type)};
   }
@@ -69,6 +72,9 @@ namespace rexsapi
     if (path.extension() == ".rexsj" || extension == ".rexs.json") {
       return TFileType::JSON;
     }
+    if (path.extension() == ".rexsb" || extension == ".rexs.bin") {
+      return TFileType::BINARY;
+    }
 
     return TFileType::UNKOWN;
   }
@@ -35,7 +35,7 @@ namespace rexsapi
       result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' is not a regular file", path.string())});
       return {};
     }
-    std::ifstream file{path};
+    std::ifstream file{path, std::ios::binary};
     if (!file.good()) {
       result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' cannot be loaded", path.string())});
       return {};
@@ -0,0 +1,44 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_HASH_HXX
+#define REXSAPI_HASH_HXX
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rexsapi::detail
+{
+  /// Initial value for fnv1a
+  inline constexpr uint64_t Fnv1aOffsetBasis = 14695981039346656037ULL;
+
+  /**
+   * @brief Continues a 64 bit FNV-1a hash over a range of bytes.
+   *
+   * FNV-1a is not a cryptographic hash, but is fast and the same on all platforms for the same bytes.
+   */
+  inline uint64_t fnv1a(uint64_t hash, const void* data, size_t size) noexcept
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t n = 0; n < size; ++n) {
+      hash ^= bytes[n];
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+}
+
+#endif
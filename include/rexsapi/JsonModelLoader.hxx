@@ -20,6 +20,7 @@
 #include <rexsapi/Json.hxx>
 #include <rexsapi/JsonSchemaValidator.hxx>
 #include <rexsapi/JsonValueDecoder.hxx>
+#include <rexsapi/LoadOptions.hxx>
 #include <rexsapi/ModelHelper.hxx>
 #include <rexsapi/database/ModelRegistry.hxx>
 
@@ -30,10 +31,12 @@ namespace rexsapi
   class TJsonModelLoader
   {
   public:
-    explicit TJsonModelLoader(TMode mode, const TJsonSchemaValidator& validator)
+    /// json documents are always validated separately, so the validation mode of the options is ignored
+    explicit TJsonModelLoader(TMode mode, const TJsonSchemaValidator& validator, const TLoadOptions& options = {})
     : m_Mode{mode}
-    , m_LoaderHelper{mode}
+    , m_LoaderHelper{mode, options.m_DecodeMode}
     , m_Validator{validator}
+    , m_Statistics{options.m_Statistics}
     {
     }
 
@@ -42,26 +45,28 @@ namespace rexsapi
 
   private:
     TComponents getComponents(TResult& result, ComponentMapping& componentMapping, const database::TModel& dbModel,
-                              const json& j) const;
+                              const std::shared_ptr<const json>& source) const;
 
     TAttributes getAttributes(std::string_view context, TResult& result, uint64_t componentId,
-                              const database::TComponent& componentType, const json& component) const;
+                              const database::TComponent& componentType, const json& component,
+                              const std::shared_ptr<const json>& source) const;
 
     TRelations getRelations(TResult& result, const ComponentMapping& componentMapping, const TComponents& components,
                             const json& j) const;
 
     TLoadCases getLoadCases(TResult& result, const ComponentMapping& componentMapping, const TComponents& components,
-                            const database::TModel& dbModel, const json& j) const;
+                            const database::TModel& dbModel, const std::shared_ptr<const json>& source) const;
 
     std::optional<TAccumulation> getAccumulation(TResult& result, const ComponentMapping& componentMapping,
                                                  const TComponents& components, const database::TModel& dbModel,
-                                                 const json& j) const;
+                                                 const std::shared_ptr<const json>& source) const;
 
     static TValueType getValueType(const json& attribute);
 
     TModeAdapter m_Mode;
     TModelHelper<TJsonValueDecoder> m_LoaderHelper;
     const TJsonSchemaValidator& m_Validator;
+    TLoadStatistics* m_Statistics;
   };
 
 
@@ -73,9 +78,20 @@ namespace rexsapi
                                                       std::vector<uint8_t>& buffer) const
   {
     try {
-      const json j = json::parse(buffer);
+      std::shared_ptr<const json> source;
+      {
+        TLoadStatistics::TScope scope{m_Statistics, TLoadPhase::PARSE, buffer.size()};
+        source = std::make_shared<const json>(json::parse(buffer));
+      }
+      const json& j = *source;
       std::vector<std::string> errors;
-      if (!m_Validator.validate(j, errors)) {
+      bool valid;
+      {
+        TLoadStatistics::TScope scope{m_Statistics, TLoadPhase::SCHEMA_VALIDATION};
+        valid = m_Validator.validate(j, errors);
+        scope.elements(errors.size());
+      }
+      if (!valid) {
         for (const auto& error : errors) {
           result.addError(TError{TErrorLevel::CRIT, error});
         }
@@ -95,10 +111,23 @@ namespace rexsapi
       const auto& dbModel = registry.getModel(info.getVersion(), "en");
 
       ComponentMapping componentMapping;
-      TComponents components = getComponents(result, componentMapping, dbModel, j);
+      TComponents components = getComponents(result, componentMapping, dbModel, source);
+      TLoadStatistics::TScope relationsPhase{m_Statistics, TLoadPhase::RELATIONS};
       TRelations relations = getRelations(result, componentMapping, components, j);
-      TLoadCases loadCases = getLoadCases(result, componentMapping, components, dbModel, j);
-      std::optional<TAccumulation> accumulation = getAccumulation(result, componentMapping, components, dbModel, j);
+      relationsPhase.elements(relations.size());
+      relationsPhase.finish();
+
+      TLoadStatistics::TScope loadSpectrumPhase{m_Statistics, TLoadPhase::LOAD_SPECTRUM};
+      TLoadCases loadCases = getLoadCases(result, componentMapping, components, dbModel, source);
+      std::optional<TAccumulation> accumulation =
+        getAccumulation(result, componentMapping, components, dbModel, source);
+      for (const auto& loadCase : loadCases) {
+        loadSpectrumPhase.addElements(loadCase.getLoadComponents().size());
+      }
+      if (accumulation) {
+        loadSpectrumPhase.addElements(accumulation->getLoadComponents().size());
+      }
+      loadSpectrumPhase.finish();
 
       return TModel{info, std::move(components), std::move(relations),
                     TLoadSpectrum{std::move(loadCases), std::move(accumulation)}};
@@ -109,17 +138,22 @@ namespace rexsapi
   }
 
   inline TComponents TJsonModelLoader::getComponents(TResult& result, ComponentMapping& componentMapping,
-                                                     const database::TModel& dbModel, const json& j) const
+                                                     const database::TModel& dbModel,
+                                                     const std::shared_ptr<const json>& source) const
   {
+    const json& j = *source;
     TComponents components;
 
+    TLoadStatistics::TScope decodingPhase{m_Statistics, TLoadPhase::VALUE_DECODING};
+    uint64_t attributeCount{0};
     for (const auto& component : j["/model/components"_json_pointer]) {
       auto componentId = component["id"].get<uint64_t>();
       std::string componentName = component.value("name", "");
       try {
         const auto& componentType = dbModel.findComponentById(component["type"].get<std::string>());
         std::string context = componentName.empty() ? componentType.getName() : componentName;
-        TAttributes attributes = getAttributes(context, result, componentId, componentType, component);
+        TAttributes attributes = getAttributes(context, result, componentId, componentType, component, source);
+        attributeCount += attributes.size();
 
         components.emplace_back(TComponent{componentMapping.addComponent(componentId), componentType.getComponentId(),
                                            componentName, std::move(attributes)});
@@ -128,13 +162,20 @@ namespace rexsapi
           TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
       }
     }
-    ComponentPostProcessor postProcessor{result, m_Mode, components, componentMapping};
-    return postProcessor.release();
+    decodingPhase.elements(attributeCount);
+    decodingPhase.finish();
+
+    TLoadStatistics::TScope referencesPhase{m_Statistics, TLoadPhase::REFERENCES};
+    ComponentPostProcessor postProcessor{result, m_Mode, std::move(components), componentMapping};
+    components = postProcessor.release();
+    referencesPhase.elements(components.size());
+    return components;
   }
 
   inline TAttributes TJsonModelLoader::getAttributes(std::string_view context, TResult& result, uint64_t componentId,
                                                      const database::TComponent& componentType,
-                                                     const json& component) const
+                                                     const json& component,
+                                                     const std::shared_ptr<const json>& source) const
   {
     TAttributes attributes;
 
@@ -152,6 +193,11 @@ namespace rexsapi
             TError{m_Mode.adapt(TErrorLevel::WARN),
                    fmt::format("{}: specified incorrect unit ({}) for attribute id={}", context, unit, id)});
         }
+        if (type == att.getValueType() && m_LoaderHelper.isLazy(type)) {
+          attributes.emplace_back(TAttribute{
+            att, TUnit{att.getUnit()}, m_LoaderHelper.getLazyValue(context, id, componentId, att, &attribute, source)});
+          continue;
+        }
         TValue value;
         if (type != att.getValueType()) {
           result.addError(
@@ -223,8 +269,9 @@ namespace rexsapi
 
   inline TLoadCases TJsonModelLoader::getLoadCases(TResult& result, const ComponentMapping& componentMapping,
                                                    const TComponents& components, const database::TModel& dbModel,
-                                                   const json& j) const
+                                                   const std::shared_ptr<const json>& source) const
   {
+    const json& j = *source;
     TLoadCases loadCases;
     if (!j.contains("/model/load_spectrum/load_cases"_json_pointer)) {
       return loadCases;
@@ -245,8 +292,8 @@ namespace rexsapi
             continue;
           }
           const auto context = fmt::format("load_case id={}", loadCaseId);
-          TAttributes attributes =
-            getAttributes(context, result, componentId, dbModel.findComponentById(component->getType()), componentRef);
+          TAttributes attributes = getAttributes(context, result, componentId,
+                                                 dbModel.findComponentById(component->getType()), componentRef, source);
           loadComponents.emplace_back(TLoadComponent(*component, std::move(attributes)));
         } catch (const std::exception& ex) {
           result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("load_case id={} component id={}: {}",
@@ -261,8 +308,10 @@ namespace rexsapi
 
   inline std::optional<TAccumulation>
   TJsonModelLoader::getAccumulation(TResult& result, const ComponentMapping& componentMapping,
-                                    const TComponents& components, const database::TModel& dbModel, const json& j) const
+                                    const TComponents& components, const database::TModel& dbModel,
+                                    const std::shared_ptr<const json>& source) const
   {
+    const json& j = *source;
     if (!j.contains("/model/load_spectrum/accumulation"_json_pointer)) {
       return std::optional<TAccumulation>{};
     }
@@ -278,7 +327,7 @@ namespace rexsapi
           continue;
         }
         TAttributes attributes = getAttributes("accumulation", result, componentId,
-                                               dbModel.findComponentById(component->getType()), componentRef);
+                                               dbModel.findComponentById(component->getType()), componentRef, source);
         loadComponents.emplace_back(TLoadComponent(*component, std::move(attributes)));
       } catch (const std::exception& ex) {
         result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
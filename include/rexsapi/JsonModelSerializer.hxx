@@ -178,75 +178,75 @@ namespace rexsapi
       return;
     }
 
-    rexsapi::dispatch<void>(attribute.getValueType(), attribute.getValue(),
-                            {[&j](rexsapi::FloatTag, const auto& d) -> void {
-                               j = d;
-                             },
-                             [&j](rexsapi::BoolTag, const auto& b) -> void {
-                               j = b;
-                             },
-                             [&j](rexsapi::IntTag, const auto& i) -> void {
-                               j = i;
-                             },
-                             [&j](rexsapi::EnumTag, const auto& s) -> void {
-                               j = s;
-                             },
-                             [&j](rexsapi::StringTag, const auto& s) -> void {
-                               j = s;
-                             },
-                             [&j](rexsapi::FileReferenceTag, const auto& s) -> void {
-                               j = s;
-                             },
-                             [&j, &attribute](rexsapi::FloatArrayTag, const auto& a) -> void {
-                               encodeCodedArray(j, attribute.getValue().coded(), a);
-                             },
-                             [&j](rexsapi::BoolArrayTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& element : a) {
-                                 j.emplace_back(*element);
-                               }
-                             },
-                             [&j, &attribute](rexsapi::IntArrayTag, const auto& a) -> void {
-                               encodeCodedArray(j, attribute.getValue().coded(), a);
-                             },
-                             [&j](rexsapi::EnumArrayTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& element : a) {
-                                 j.emplace_back(element);
-                               }
-                             },
-                             [&j](rexsapi::StringArrayTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& element : a) {
-                                 j.emplace_back(element);
-                               }
-                             },
-                             [&j, this](rexsapi::ReferenceComponentTag, const auto& n) -> void {
-                               j = getComponentId(static_cast<uint64_t>(n));
-                             },
-                             [&j, &attribute](rexsapi::FloatMatrixTag, const auto& m) -> void {
-                               encodeCodedMatrix(j, attribute.getValue().coded(), m);
-                             },
-                             [&j](rexsapi::StringMatrixTag, const auto& m) -> void {
-                               j = json::array();
-                               for (const auto& row : m.m_Values) {
-                                 auto columns = json::array();
-                                 for (const auto& column : row) {
-                                   columns.emplace_back(column);
-                                 }
-                                 j.emplace_back(std::move(columns));
-                               }
-                             },
-                             [&j](rexsapi::ArrayOfIntArraysTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& array : a) {
-                                 auto columns = json::array();
-                                 for (const auto& column : array) {
-                                   columns.emplace_back(column);
-                                 }
-                                 j.emplace_back(std::move(columns));
-                               }
-                             }});
+    rexsapi::visit<void>(attribute.getValueType(), attribute.getValue(),
+                         [&j](rexsapi::FloatTag, const auto& d) -> void {
+                           j = d;
+                         },
+                         [&j](rexsapi::BoolTag, const auto& b) -> void {
+                           j = b;
+                         },
+                         [&j](rexsapi::IntTag, const auto& i) -> void {
+                           j = i;
+                         },
+                         [&j](rexsapi::EnumTag, const auto& s) -> void {
+                           j = s;
+                         },
+                         [&j](rexsapi::StringTag, const auto& s) -> void {
+                           j = s;
+                         },
+                         [&j](rexsapi::FileReferenceTag, const auto& s) -> void {
+                           j = s;
+                         },
+                         [&j, &attribute](rexsapi::FloatArrayTag, const auto& a) -> void {
+                           encodeCodedArray(j, attribute.getValue().coded(), a);
+                         },
+                         [&j](rexsapi::BoolArrayTag, const auto& a) -> void {
+                           j = json::array();
+                           for (const auto& element : a) {
+                             j.emplace_back(*element);
+                           }
+                         },
+                         [&j, &attribute](rexsapi::IntArrayTag, const auto& a) -> void {
+                           encodeCodedArray(j, attribute.getValue().coded(), a);
+                         },
+                         [&j](rexsapi::EnumArrayTag, const auto& a) -> void {
+                           j = json::array();
+                           for (const auto& element : a) {
+                             j.emplace_back(element);
+                           }
+                         },
+                         [&j](rexsapi::StringArrayTag, const auto& a) -> void {
+                           j = json::array();
+                           for (const auto& element : a) {
+                             j.emplace_back(element);
+                           }
+                         },
+                         [&j, this](rexsapi::ReferenceComponentTag, const auto& n) -> void {
+                           j = getComponentId(static_cast<uint64_t>(n));
+                         },
+                         [&j, &attribute](rexsapi::FloatMatrixTag, const auto& m) -> void {
+                           encodeCodedMatrix(j, attribute.getValue().coded(), m);
+                         },
+                         [&j](rexsapi::StringMatrixTag, const auto& m) -> void {
+                           j = json::array();
+                           for (const auto& row : m.m_Values) {
+                             auto columns = json::array();
+                             for (const auto& column : row) {
+                               columns.emplace_back(column);
+                             }
+                             j.emplace_back(std::move(columns));
+                           }
+                         },
+                         [&j](rexsapi::ArrayOfIntArraysTag, const auto& a) -> void {
+                           j = json::array();
+                           for (const auto& array : a) {
+                             auto columns = json::array();
+                             for (const auto& column : array) {
+                               columns.emplace_back(column);
+                             }
+                             j.emplace_back(std::move(columns));
+                           }
+                         });
   }
 
   inline void JsonModelSerializer::serialize(ordered_json& model, const TRelations& relations)
@@ -21,8 +21,11 @@
 #include <rexsapi/FileUtils.hxx>
 #include <rexsapi/Format.hxx>
 #include <rexsapi/Json.hxx>
+#include <rexsapi/JsonStructureValidator.hxx>
+#include <rexsapi/SchemaValidatorCache.hxx>
 
 #include <filesystem>
+#include <optional>
 #define VALIJSON_USE_EXCEPTIONS 1
 #include <valijson/adapters/nlohmann_json_adapter.hpp>
 #include <valijson/schema.hpp>
@@ -44,6 +47,11 @@ namespace rexsapi
 
     [[nodiscard]] json load() const;
 
+    [[nodiscard]] const std::filesystem::path& getPath() const noexcept
+    {
+      return m_JsonFile;
+    }
+
   private:
     std::filesystem::path m_JsonFile;
   };
@@ -69,6 +77,16 @@ namespace rexsapi
   };
 
 
+  /**
+   * @brief Selects the implementation used to validate json documents.
+   *
+   * COMPILED uses the TJsonStructureValidator compiled from the schema and falls back to valijson if the schema uses
+   * keywords the compiled validator does not support. VALIJSON always uses the valijson library and serves as
+   * reference.
+   */
+  enum class TJsonValidationEngine { COMPILED, VALIJSON };
+
+
   class TJsonSchemaValidator
   {
   public:
@@ -85,14 +103,30 @@ namespace rexsapi
         // TODO(lcf): add exception message
         throw TException{"Cannot populate schema"};
       }
+
+      try {
+        m_Compiled.emplace(doc);
+      } catch (const TException&) {
+        // the schema uses keywords not supported by the compiled validator, documents are checked with valijson
+      }
     }
 
-    [[nodiscard]] bool validate(const json& doc, std::vector<std::string>& errors) const;
+    [[nodiscard]] bool validate(const json& doc, std::vector<std::string>& errors,
+                                TJsonValidationEngine engine = TJsonValidationEngine::COMPILED) const;
+
+    [[nodiscard]] bool isCompiled() const noexcept
+    {
+      return m_Compiled.has_value();
+    }
 
   private:
     valijson::Schema m_Schema;
+    std::optional<TJsonStructureValidator> m_Compiled;
   };
 
+
+  using TJsonSchemaValidatorCache = TSchemaValidatorCache<TJsonSchemaValidator, TBufferJsonSchemaLoader>;
+
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
@@ -129,8 +163,22 @@ namespace rexsapi
     return doc;
   }
 
-  inline bool TJsonSchemaValidator::validate(const json& doc, std::vector<std::string>& errors) const
+  inline bool TJsonSchemaValidator::validate(const json& doc, std::vector<std::string>& errors,
+                                             TJsonValidationEngine engine) const
   {
+    if (engine == TJsonValidationEngine::COMPILED && m_Compiled) {
+      std::vector<TJsonSchemaIssue> issues;
+      unsigned int errorNum = 0;
+      if (!m_Compiled->validate(doc, issues)) {
+        for (const auto& issue : issues) {
+          errors.emplace_back(
+            fmt::format("Error #{} context: {} desc: {}", ++errorNum, issue.m_Context, issue.m_Description));
+          ++errorNum;
+        }
+      }
+      return errors.empty();
+    }
+
     valijson::Validator validator(valijson::Validator::kStrongTypes);
     valijson::ValidationResults results;
     valijson::adapters::NlohmannJsonAdapter targetDocumentAdapter(doc);
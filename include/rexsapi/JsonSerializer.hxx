@@ -18,9 +18,11 @@
 #define REXSAPI_JSON_SERIALIZER_HXX
 
 #include <rexsapi/Json.hxx>
+#include <rexsapi/ZipArchive.hxx>
 
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
 
 namespace rexsapi
 {
@@ -67,6 +69,32 @@ namespace rexsapi
   private:
     std::filesystem::path m_File;
   };
+
+
+  class JsonZipFileSerializer
+  {
+  public:
+    explicit JsonZipFileSerializer(std::filesystem::path file, int compressionLevel = MZ_DEFAULT_LEVEL)
+    : m_File{std::move(file)}
+    , m_CompressionLevel{compressionLevel}
+    {
+    }
+
+    void serialize(const ordered_json& doc)
+    {
+      ZipArchiveWriter writer{m_File, zipEntryName(m_File, TFileType::JSON), m_CompressionLevel};
+      std::ostream stream{&writer};
+      stream << std::setw(2) << doc;
+      if (!stream) {
+        throw TException{fmt::format("Could not serialize model to {}", m_File.string())};
+      }
+      writer.close();
+    }
+
+  private:
+    std::filesystem::path m_File;
+    int m_CompressionLevel;
+  };
 }
 
 #endif
@@ -0,0 +1,476 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_JSON_STRUCTURE_VALIDATOR_HXX
+#define REXSAPI_JSON_STRUCTURE_VALIDATOR_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+#include <rexsapi/Json.hxx>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rexsapi
+{
+  struct TJsonSchemaIssue {
+    std::string m_Context;
+    std::string m_Description;
+  };
+
+
+  /**
+   * @brief Validates json documents against a json schema compiled into a flat node table.
+   *
+   * Only the subset of draft-07 keywords used by the REXS json schema is supported. Compiling a schema with other
+   * validation keywords throws a TException. Documents are checked in a single pass. Issues are only collected for
+   * invalid documents, using the contexts, descriptions, and order of the valijson library.
+   *
+   * The REXS json schema uses the draft 2019-09 keyword unevaluatedProperties, which valijson does not support. To
+   * report the same issues as valijson, the keyword is accepted but not enforced, so objects with additional
+   * properties are valid. Such keywords are returned by getIgnoredKeywords.
+   */
+  class TJsonStructureValidator
+  {
+  public:
+    explicit TJsonStructureValidator(const json& schema);
+
+    [[nodiscard]] bool validate(const json& doc, std::vector<TJsonSchemaIssue>& issues) const;
+
+    /// Returns the keywords of the schema that are accepted but not enforced
+    [[nodiscard]] const std::vector<std::string>& getIgnoredKeywords() const&
+    {
+      return m_IgnoredKeywords;
+    }
+
+  private:
+    enum TTypes : uint8_t {
+      NULL_TYPE = 1 << 0,
+      BOOLEAN_TYPE = 1 << 1,
+      INTEGER_TYPE = 1 << 2,
+      NUMBER_TYPE = 1 << 3,
+      STRING_TYPE = 1 << 4,
+      ARRAY_TYPE = 1 << 5,
+      OBJECT_TYPE = 1 << 6
+    };
+
+    struct TNode {
+      uint8_t m_Types{0};
+      std::optional<std::vector<json>> m_Enum;
+      std::optional<size_t> m_Items;
+      std::optional<double> m_Minimum;
+      bool m_ExclusiveMinimum{false};
+      std::optional<uint64_t> m_MinItems;
+      std::vector<size_t> m_OneOf;
+      std::unordered_map<std::string, std::vector<size_t>> m_OneOfKeys;
+      std::optional<std::regex> m_Pattern;
+      std::vector<std::pair<std::string, size_t>> m_Properties;
+      std::vector<std::string> m_Required;
+    };
+
+    class TContext
+    {
+    public:
+      explicit TContext(std::vector<TJsonSchemaIssue>& issues)
+      : m_Issues{issues}
+      {
+      }
+
+      void push(std::string segment)
+      {
+        m_Path.emplace_back(std::move(segment));
+      }
+
+      void pop()
+      {
+        m_Path.pop_back();
+      }
+
+      void addIssue(std::string description);
+
+    private:
+      std::vector<std::string> m_Path{"<root>"};
+      std::vector<TJsonSchemaIssue>& m_Issues;
+    };
+
+    size_t compile(const json& schema, const json& root, std::unordered_map<const json*, size_t>& compiled);
+
+    [[nodiscard]] bool validate(size_t index, const json& value, TContext* context) const;
+
+    [[nodiscard]] bool validateItems(const TNode& node, const json& value, TContext* context) const;
+
+    [[nodiscard]] bool validateOneOf(const TNode& node, const json& value, TContext* context) const;
+
+    [[nodiscard]] bool validateProperties(const TNode& node, const json& value, TContext* context) const;
+
+    [[nodiscard]] size_t countOneOfMatches(const TNode& node, const json& value) const;
+
+    static uint8_t getTypes(const json& type);
+
+    static bool matchesType(uint8_t types, const json& value) noexcept;
+
+    std::vector<TNode> m_Nodes;
+    std::vector<std::string> m_IgnoredKeywords;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline void TJsonStructureValidator::TContext::addIssue(std::string description)
+  {
+    std::string context;
+    for (const auto& segment : m_Path) {
+      context += segment;
+    }
+    m_Issues.emplace_back(TJsonSchemaIssue{std::move(context), std::move(description)});
+  }
+
+  inline TJsonStructureValidator::TJsonStructureValidator(const json& schema)
+  {
+    std::unordered_map<const json*, size_t> compiled;
+    try {
+      compile(schema, schema, compiled);
+    } catch (const json::exception& ex) {
+      throw TException{fmt::format("cannot compile json schema: {}", ex.what())};
+    } catch (const std::regex_error& ex) {
+      throw TException{fmt::format("cannot compile json schema pattern: {}", ex.what())};
+    }
+  }
+
+  inline bool TJsonStructureValidator::validate(const json& doc, std::vector<TJsonSchemaIssue>& issues) const
+  {
+    // the fast pass stops at the first failure, the issues are only collected in a second pass
+    if (validate(0, doc, nullptr)) {
+      return true;
+    }
+    TContext context{issues};
+    (void)validate(0, doc, &context);
+    return false;
+  }
+
+  inline size_t TJsonStructureValidator::compile(const json& schema, const json& root,
+                                                 std::unordered_map<const json*, size_t>& compiled)
+  {
+    if (!schema.is_object()) {
+      throw TException{"json schema is not an object"};
+    }
+    if (auto it = schema.find("$ref"); it != schema.end()) {
+      const auto& ref = it->get<std::string>();
+      if (ref.empty() || ref[0] != '#') {
+        throw TException{fmt::format("unsupported json schema reference '{}'", ref)};
+      }
+      return compile(root.at(json::json_pointer{ref.substr(1)}), root, compiled);
+    }
+    if (auto it = compiled.find(&schema); it != compiled.end()) {
+      return it->second;
+    }
+
+    const size_t index = m_Nodes.size();
+    compiled.emplace(&schema, index);
+    m_Nodes.emplace_back();
+    // ATTENTION: nested schemas are compiled into m_Nodes, so the node is only filled and stored at the end
+    TNode node;
+
+    for (const auto& [key, value] : schema.items()) {
+      if (key == "type") {
+        node.m_Types = getTypes(value);
+      } else if (key == "enum") {
+        node.m_Enum = value.get<std::vector<json>>();
+      } else if (key == "items") {
+        node.m_Items = compile(value, root, compiled);
+      } else if (key == "minimum") {
+        node.m_Minimum = value.get<double>();
+      } else if (key == "exclusiveMinimum") {
+        node.m_Minimum = value.get<double>();
+        node.m_ExclusiveMinimum = true;
+      } else if (key == "minItems") {
+        node.m_MinItems = value.get<uint64_t>();
+      } else if (key == "oneOf") {
+        for (const auto& branch : value) {
+          node.m_OneOf.emplace_back(compile(branch, root, compiled));
+        }
+      } else if (key == "pattern") {
+        node.m_Pattern = std::regex{value.get<std::string>()};
+      } else if (key == "properties") {
+        for (const auto& [name, property] : value.items()) {
+          node.m_Properties.emplace_back(name, compile(property, root, compiled));
+        }
+      } else if (key == "required") {
+        node.m_Required = value.get<std::vector<std::string>>();
+      } else if (key == "unevaluatedProperties") {
+        if (std::find(m_IgnoredKeywords.begin(), m_IgnoredKeywords.end(), key) == m_IgnoredKeywords.end()) {
+          m_IgnoredKeywords.emplace_back(key);
+        }
+      } else if (key != "$schema" && key != "$id" && key != "$defs" && key != "definitions" && key != "title" &&
+                 key != "description" && key != "default" && key != "format") {
+        throw TException{fmt::format("unsupported json schema keyword '{}'", key)};
+      }
+    }
+
+    std::sort(node.m_Properties.begin(), node.m_Properties.end());
+    std::sort(node.m_Required.begin(), node.m_Required.end());
+    node.m_Required.erase(std::unique(node.m_Required.begin(), node.m_Required.end()), node.m_Required.end());
+
+    // oneOf branches requiring distinct properties can be selected by the properties present in an object
+    bool discriminated = true;
+    for (const auto branch : node.m_OneOf) {
+      const auto& required = branch == index ? node.m_Required : m_Nodes[branch].m_Required;
+      if (required.empty()) {
+        discriminated = false;
+        break;
+      }
+      node.m_OneOfKeys[required.front()].emplace_back(branch);
+    }
+    if (!discriminated) {
+      node.m_OneOfKeys.clear();
+    }
+
+    m_Nodes[index] = std::move(node);
+    return index;
+  }
+
+  inline bool TJsonStructureValidator::validate(size_t index, const json& value, TContext* context) const
+  {
+    const auto& node = m_Nodes[index];
+
+    // the constraints are checked in the same order as valijson does and the first failing constraint ends the check
+    if (node.m_Enum && std::find(node.m_Enum->begin(), node.m_Enum->end(), value) == node.m_Enum->end()) {
+      if (context) {
+        context->addIssue("Failed to match against any enum values.");
+      }
+      return false;
+    }
+    if (node.m_Items && value.is_array() && !validateItems(node, value, context)) {
+      return false;
+    }
+    if (node.m_Minimum && value.is_number()) {
+      const auto number = value.get<double>();
+      if (node.m_ExclusiveMinimum ? number <= *node.m_Minimum : number < *node.m_Minimum) {
+        if (context) {
+          context->addIssue(fmt::format("Expected number greater than {}{}",
+                                        node.m_ExclusiveMinimum ? "" : "or equal to ",
+                                        std::to_string(*node.m_Minimum)));
+        }
+        return false;
+      }
+    }
+    if (node.m_MinItems && value.is_array() && value.size() < *node.m_MinItems) {
+      if (context) {
+        context->addIssue(fmt::format("Array should contain no fewer than {} elements.", *node.m_MinItems));
+      }
+      return false;
+    }
+    if (!node.m_OneOf.empty() && !validateOneOf(node, value, context)) {
+      return false;
+    }
+    if (node.m_Pattern && value.is_string() &&
+        !std::regex_search(value.get_ref<const std::string&>(), *node.m_Pattern)) {
+      if (context) {
+        context->addIssue("Failed to match regex specified by 'pattern' constraint.");
+      }
+      return false;
+    }
+    if (!node.m_Properties.empty() && value.is_object() && !validateProperties(node, value, context)) {
+      return false;
+    }
+    if (!node.m_Required.empty() && value.is_object()) {
+      bool validated = true;
+      for (const auto& name : node.m_Required) {
+        if (value.find(name) == value.end()) {
+          if (!context) {
+            return false;
+          }
+          context->addIssue(fmt::format("Missing required property '{}'.", name));
+          validated = false;
+        }
+      }
+      if (!validated) {
+        return false;
+      }
+    }
+    if (node.m_Types && !matchesType(node.m_Types, value)) {
+      if (context) {
+        context->addIssue("Value type not permitted by 'type' constraint.");
+      }
+      return false;
+    }
+
+    return true;
+  }
+
+  inline bool TJsonStructureValidator::validateItems(const TNode& node, const json& value, TContext* context) const
+  {
+    bool validated = true;
+    size_t n = 0;
+    for (const auto& item : value) {
+      if (context) {
+        context->push(fmt::format("[{}]", n));
+      }
+      const bool result = validate(*node.m_Items, item, context);
+      if (context) {
+        context->pop();
+      }
+      if (!result) {
+        if (!context) {
+          return false;
+        }
+        context->addIssue(fmt::format("Failed to validate item #{} in array.", n));
+        validated = false;
+      }
+      ++n;
+    }
+    return validated;
+  }
+
+  inline bool TJsonStructureValidator::validateOneOf(const TNode& node, const json& value, TContext* context) const
+  {
+    const auto matches = countOneOfMatches(node, value);
+    if (matches == 1) {
+      return true;
+    }
+    if (context) {
+      if (matches == 0) {
+        for (size_t n = 0; n < node.m_OneOf.size(); ++n) {
+          if (!validate(node.m_OneOf[n], value, context)) {
+            context->addIssue(fmt::format("Failed to validate against child schema #{}.", n));
+          }
+        }
+        context->addIssue("Failed to validate against any child schemas allowed by oneOf constraint.");
+      } else {
+        context->addIssue("Failed to validate against exactly one child schema.");
+      }
+    }
+    return false;
+  }
+
+  inline bool TJsonStructureValidator::validateProperties(const TNode& node, const json& value, TContext* context) const
+  {
+    bool validated = true;
+    for (const auto& [name, index] : node.m_Properties) {
+      const auto it = value.find(name);
+      if (it == value.end()) {
+        continue;
+      }
+      if (context) {
+        context->push(fmt::format("[{}]", name));
+      }
+      const bool result = validate(index, *it, context);
+      if (context) {
+        context->pop();
+      }
+      if (!result) {
+        if (!context) {
+          return false;
+        }
+        context->addIssue(fmt::format("Failed to validate against schema associated with property name '{}'.", name));
+        validated = false;
+      }
+    }
+    return validated;
+  }
+
+  inline size_t TJsonStructureValidator::countOneOfMatches(const TNode& node, const json& value) const
+  {
+    size_t matches = 0;
+    if (!node.m_OneOfKeys.empty() && value.is_object()) {
+      // only branches with their first required property present can match
+      for (const auto& member : value.items()) {
+        const auto it = node.m_OneOfKeys.find(member.key());
+        if (it == node.m_OneOfKeys.end()) {
+          continue;
+        }
+        for (const auto branch : it->second) {
+          if (validate(branch, value, nullptr)) {
+            ++matches;
+          }
+        }
+      }
+      return matches;
+    }
+    for (const auto branch : node.m_OneOf) {
+      if (validate(branch, value, nullptr)) {
+        ++matches;
+      }
+    }
+    return matches;
+  }
+
+  inline uint8_t TJsonStructureValidator::getTypes(const json& type)
+  {
+    if (type.is_array()) {
+      uint8_t types{0};
+      for (const auto& t : type) {
+        types = static_cast<uint8_t>(types | getTypes(t));
+      }
+      return types;
+    }
+    const auto& name = type.get_ref<const std::string&>();
+    if (name == "null") {
+      return NULL_TYPE;
+    }
+    if (name == "boolean") {
+      return BOOLEAN_TYPE;
+    }
+    if (name == "integer") {
+      return INTEGER_TYPE;
+    }
+    if (name == "number") {
+      return NUMBER_TYPE;
+    }
+    if (name == "string") {
+      return STRING_TYPE;
+    }
+    if (name == "array") {
+      return ARRAY_TYPE;
+    }
+    if (name == "object") {
+      return OBJECT_TYPE;
+    }
+    throw TException{fmt::format("unknown json schema type '{}'", name)};
+  }
+
+  inline bool TJsonStructureValidator::matchesType(uint8_t types, const json& value) noexcept
+  {
+    switch (value.type()) {
+      case json::value_t::null:
+        return types & NULL_TYPE;
+      case json::value_t::boolean:
+        return types & BOOLEAN_TYPE;
+      case json::value_t::number_integer:
+      case json::value_t::number_unsigned:
+        return types & (INTEGER_TYPE | NUMBER_TYPE);
+      case json::value_t::number_float:
+        return types & NUMBER_TYPE;
+      case json::value_t::string:
+        return types & STRING_TYPE;
+      case json::value_t::array:
+        return types & ARRAY_TYPE;
+      case json::value_t::object:
+        return types & OBJECT_TYPE;
+      default:
+        return false;
+    }
+  }
+}
+
+#endif
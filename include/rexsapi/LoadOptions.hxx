@@ -0,0 +1,39 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_LOAD_OPTIONS_HXX
+#define REXSAPI_LOAD_OPTIONS_HXX
+
+#include <rexsapi/LoadStatistics.hxx>
+#include <rexsapi/Mode.hxx>
+
+namespace rexsapi
+{
+  /**
+   * @brief Options for loading a model file or buffer.
+   *
+   * A default constructed instance loads eagerly, validates the document separately and collects no statistics.
+   */
+  struct TLoadOptions {
+    TDecodeMode m_DecodeMode{TDecodeMode::EAGER};
+    TValidationMode m_ValidationMode{TValidationMode::SEPARATE};
+    /// If set, the wall time, bytes and element counts of the load phases are added to the statistics. If the
+    /// TAllocationCounter is enabled, the allocations of the phases and of the whole load are added too.
+    TLoadStatistics* m_Statistics{nullptr};
+  };
+}
+
+#endif
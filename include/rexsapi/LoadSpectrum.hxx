@@ -33,6 +33,7 @@ namespace rexsapi
                     [this](const auto& attribute) {
                       m_Attributes.emplace_back(attribute);
                     });
+      m_Index = detail::TAttributeIndex{m_Attributes};
     }
 
     const TComponent& getComponent() const&
@@ -50,10 +51,33 @@ namespace rexsapi
       return m_LoadAttributes;
     }
 
+    /// Returns the attribute with the id or nullptr, load attributes are found before component attributes
+    [[nodiscard]] const TAttribute* findAttribute(std::string_view attributeId) const
+    {
+      return m_Index.find(m_Attributes, attributeId);
+    }
+
+    /**
+     * @brief Returns the value of the attribute with the id.
+     *
+     * @throws TException if neither the load component nor the component have an attribute with the id
+     */
+    template<typename T>
+    [[nodiscard]] const auto& getValue(std::string_view attributeId) const&
+    {
+      const auto* attribute = findAttribute(attributeId);
+      if (attribute == nullptr) {
+        throw TException{
+          fmt::format("load component id={} has no attribute id={}", m_Component.getInternalId(), attributeId)};
+      }
+      return attribute->getValue<T>();
+    }
+
   private:
     const TComponent& m_Component;
     TAttributes m_Attributes;
     TAttributes m_LoadAttributes;
+    detail::TAttributeIndex m_Index;
   };
 
   using TLoadComponents = std::vector<TLoadComponent>;
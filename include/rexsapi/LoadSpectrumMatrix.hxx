@@ -0,0 +1,178 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_LOAD_SPECTRUM_MATRIX_HXX
+#define REXSAPI_LOAD_SPECTRUM_MATRIX_HXX
+
+#include <rexsapi/LoadSpectrum.hxx>
+
+#include <limits>
+#include <unordered_map>
+
+namespace rexsapi
+{
+  /**
+   * @brief Selects an attribute of a component for a load spectrum matrix.
+   */
+  struct TLoadSpectrumColumn {
+    uint64_t m_ComponentId;
+    std::string m_AttributeId;
+  };
+
+  using TLoadSpectrumColumns = std::vector<TLoadSpectrumColumn>;
+
+
+  /**
+   * @brief Dense matrix of attribute values of a load spectrum.
+   *
+   * Every load case is a row and every selected attribute a column. The values are stored contiguously in row major
+   * order, so all values of a load case are adjacent and a column is found with a constant stride. The values of the
+   * selected attributes in the accumulation are stored in a vector parallel to the columns.
+   *
+   * Load components are found by the internal id of their component, attributes of a load component are found before
+   * attributes of its component. If a load case contains a component more than once, the first value found is used.
+   * Values that cannot be found are NaN. Integer values are converted to double.
+   */
+  class TLoadSpectrumMatrix
+  {
+  public:
+    /**
+     * @throws TException if a selected attribute is neither a floating point nor an integer attribute
+     */
+    TLoadSpectrumMatrix(const TLoadSpectrum& spectrum, TLoadSpectrumColumns columns);
+
+    [[nodiscard]] size_t getLoadCaseCount() const noexcept
+    {
+      return m_LoadCaseCount;
+    }
+
+    [[nodiscard]] size_t getColumnCount() const noexcept
+    {
+      return m_Columns.size();
+    }
+
+    [[nodiscard]] const TLoadSpectrumColumns& getColumns() const&
+    {
+      return m_Columns;
+    }
+
+    /// All values in row major order
+    [[nodiscard]] const double* data() const noexcept
+    {
+      return m_Values.data();
+    }
+
+    [[nodiscard]] const double* getLoadCase(size_t loadCase) const noexcept
+    {
+      return m_Values.data() + loadCase * m_Columns.size();
+    }
+
+    [[nodiscard]] double operator()(size_t loadCase, size_t column) const noexcept
+    {
+      return m_Values[loadCase * m_Columns.size() + column];
+    }
+
+    /// The value of every column in the accumulation, NaN for all columns if the spectrum has no accumulation
+    [[nodiscard]] const std::vector<double>& getAccumulation() const&
+    {
+      return m_Accumulation;
+    }
+
+    /// Returns the number of values that could not be found in the load cases
+    [[nodiscard]] size_t getMissingCount() const noexcept
+    {
+      return m_MissingCount;
+    }
+
+  private:
+    size_t extract(const TLoadComponents& components, double* values, std::vector<bool>& found) const;
+
+    TLoadSpectrumColumns m_Columns;
+    size_t m_LoadCaseCount;
+    std::unordered_map<uint64_t, std::vector<size_t>> m_ComponentColumns;
+    std::vector<double> m_Values;
+    std::vector<double> m_Accumulation;
+    size_t m_MissingCount{0};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TLoadSpectrumMatrix::TLoadSpectrumMatrix(const TLoadSpectrum& spectrum, TLoadSpectrumColumns columns)
+  : m_Columns{std::move(columns)}
+  , m_LoadCaseCount{spectrum.getLoadCases().size()}
+  , m_Values(m_LoadCaseCount * m_Columns.size(), std::numeric_limits<double>::quiet_NaN())
+  , m_Accumulation(m_Columns.size(), std::numeric_limits<double>::quiet_NaN())
+  {
+    for (size_t n = 0; n < m_Columns.size(); ++n) {
+      m_ComponentColumns[m_Columns[n].m_ComponentId].emplace_back(n);
+    }
+
+    auto* values = m_Values.data();
+    std::vector<bool> found;
+    for (const auto& loadCase : spectrum.getLoadCases()) {
+      m_MissingCount += m_Columns.size() - extract(loadCase.getLoadComponents(), values, found);
+      values += m_Columns.size();
+    }
+
+    if (spectrum.hasAccumulation()) {
+      extract(spectrum.getAccumulation().getLoadComponents(), m_Accumulation.data(), found);
+    }
+  }
+
+  inline size_t TLoadSpectrumMatrix::extract(const TLoadComponents& components, double* values,
+                                             std::vector<bool>& found) const
+  {
+    // returns the number of distinct cells found, so duplicated components are not counted twice
+    found.assign(m_Columns.size(), false);
+    size_t count = 0;
+    for (const auto& component : components) {
+      const auto it = m_ComponentColumns.find(component.getComponent().getInternalId());
+      if (it == m_ComponentColumns.end()) {
+        continue;
+      }
+      for (const auto column : it->second) {
+        if (found[column]) {
+          continue;
+        }
+        const auto* attribute = component.findAttribute(m_Columns[column].m_AttributeId);
+        if (attribute == nullptr || !attribute->hasValue()) {
+          continue;
+        }
+        switch (attribute->getValueType()) {
+          case TValueType::FLOATING_POINT:
+            values[column] = attribute->getValue<TFloatType>();
+            break;
+          case TValueType::INTEGER:
+            values[column] = static_cast<double>(attribute->getValue<TIntType>());
+            break;
+          default:
+            throw TException{fmt::format("attribute id={} of component id={} has type {} which cannot be stored in a "
+                                         "load spectrum matrix",
+                                         m_Columns[column].m_AttributeId, component.getComponent().getInternalId(),
+                                         toTypeString(attribute->getValueType()))};
+        }
+        found[column] = true;
+        ++count;
+      }
+    }
+    return count;
+  }
+}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_LOAD_STATISTICS_HXX
+#define REXSAPI_LOAD_STATISTICS_HXX
+
+#include <rexsapi/AllocationCounter.hxx>
+#include <rexsapi/Exception.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rexsapi
+{
+  /**
+   * @brief The phases of a model load.
+   *
+   * The meaning of the element count depends on the phase.
+   */
+  enum class TLoadPhase {
+    FILE_READ,          ///< Reading or mapping the file, no elements
+    INFLATE,            ///< Extracting the model from a zip archive, no elements
+    PARSE,              ///< Parsing the xml or json document, no elements
+    SCHEMA_VALIDATION,  ///< Validating the document against the schema, elements are schema issues
+    VALUE_DECODING,     ///< Building components and decoding their values, elements are attributes
+    REFERENCES,         ///< Resolving reference component attributes, elements are components
+    RELATIONS,          ///< Building relations, elements are relations
+    LOAD_SPECTRUM       ///< Building load cases and the accumulation, elements are load components
+  };
+
+  static std::string toLoadPhaseString(TLoadPhase phase);
+
+
+  struct TLoadPhaseStatistics {
+    TLoadPhase m_Phase;
+    std::chrono::nanoseconds m_Duration{0};
+    uint64_t m_Bytes{0};
+    uint64_t m_Elements{0};
+    /// Only counted if the TAllocationCounter is enabled, the peak is the highest peak of all recordings of the phase
+    TAllocationStatistics m_Memory{};
+  };
+
+
+  /**
+   * @brief Collects wall time, bytes and element counts per phase of a model load.
+   *
+   * Statistics can be passed to TModelLoader::load next to the TResult. Phases recorded multiple times are summed up.
+   * Phases are reported in the order they were first recorded.
+   */
+  class TLoadStatistics
+  {
+  public:
+    /**
+     * @brief Records the time from construction to destruction for a phase.
+     *
+     * Does nothing if no statistics are given, so loaders can always create a scope. Also records the allocations of
+     * the phase if the TAllocationCounter is enabled.
+     */
+    class TScope
+    {
+    public:
+      TScope(TLoadStatistics* statistics, TLoadPhase phase, uint64_t bytes = 0) noexcept
+      : m_Statistics{statistics}
+      , m_Phase{phase}
+      , m_Bytes{bytes}
+      {
+        if (m_Statistics != nullptr) {
+          if (TAllocationCounter::isEnabled()) {
+            m_Allocations.emplace();
+          }
+          m_Start = std::chrono::steady_clock::now();
+        }
+      }
+
+      ~TScope()
+      {
+        finish();
+      }
+
+      TScope(const TScope&) = delete;
+      TScope& operator=(const TScope&) = delete;
+      TScope(TScope&&) = delete;
+      TScope& operator=(TScope&&) = delete;
+
+      void bytes(uint64_t bytes) noexcept
+      {
+        m_Bytes = bytes;
+      }
+
+      void elements(uint64_t elements) noexcept
+      {
+        m_Elements = elements;
+      }
+
+      void addElements(uint64_t elements) noexcept
+      {
+        m_Elements += elements;
+      }
+
+      /// Records the phase before the end of the scope, later calls do nothing
+      void finish()
+      {
+        if (m_Statistics != nullptr) {
+          const auto duration = std::chrono::steady_clock::now() - m_Start;
+          m_Statistics->add(m_Phase, duration, m_Bytes, m_Elements,
+                            m_Allocations ? m_Allocations->finish() : TAllocationStatistics{});
+          m_Statistics = nullptr;
+        }
+      }
+
+    private:
+      TLoadStatistics* m_Statistics;
+      TLoadPhase m_Phase;
+      uint64_t m_Bytes;
+      uint64_t m_Elements{0};
+      std::chrono::steady_clock::time_point m_Start{};
+      std::optional<TAllocationCounter::TScope> m_Allocations;
+    };
+
+    void add(TLoadPhase phase, std::chrono::nanoseconds duration, uint64_t bytes, uint64_t elements,
+             const TAllocationStatistics& memory = {});
+
+    [[nodiscard]] const std::vector<TLoadPhaseStatistics>& getPhases() const&
+    {
+      return m_Phases;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds getDuration() const;
+
+    /**
+     * @brief Adds the allocations of a whole load.
+     *
+     * Loads recorded multiple times are summed up, the peak is the highest peak of all loads.
+     */
+    void addMemory(const TAllocationStatistics& memory) noexcept;
+
+    /**
+     * @brief The allocations of the whole load, including allocations between the phases.
+     *
+     * Only recorded by TModelLoader::load if the TAllocationCounter is enabled. The phases overlap in time with their
+     * intermediate data, so the peak of the load cannot be derived from the peaks of the phases.
+     */
+    [[nodiscard]] const TAllocationStatistics& getMemory() const& noexcept
+    {
+      return m_Memory;
+    }
+
+    void reset() noexcept
+    {
+      m_Phases.clear();
+      m_Memory = TAllocationStatistics{};
+    }
+
+  private:
+    std::vector<TLoadPhaseStatistics> m_Phases;
+    TAllocationStatistics m_Memory{};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  static inline std::string toLoadPhaseString(TLoadPhase phase)
+  {
+    switch (phase) {
+      case TLoadPhase::FILE_READ:
+        return "file_read";
+      case TLoadPhase::INFLATE:
+        return "inflate";
+      case TLoadPhase::PARSE:
+        return "parse";
+      case TLoadPhase::SCHEMA_VALIDATION:
+        return "schema_validation";
+      case TLoadPhase::VALUE_DECODING:
+        return "value_decoding";
+      case TLoadPhase::REFERENCES:
+        return "references";
+      case TLoadPhase::RELATIONS:
+        return "relations";
+      case TLoadPhase::LOAD_SPECTRUM:
+        return "load_spectrum";
+    }
+    throw TException{"unknown load phase"};
+  }
+
+  inline void TLoadStatistics::add(TLoadPhase phase, std::chrono::nanoseconds duration, uint64_t bytes,
+                                   uint64_t elements, const TAllocationStatistics& memory)
+  {
+    for (auto& statistics : m_Phases) {
+      if (statistics.m_Phase == phase) {
+        statistics.m_Duration += duration;
+        statistics.m_Bytes += bytes;
+        statistics.m_Elements += elements;
+        statistics.m_Memory.m_Allocations += memory.m_Allocations;
+        statistics.m_Memory.m_Bytes += memory.m_Bytes;
+        statistics.m_Memory.m_PeakBytes = std::max(statistics.m_Memory.m_PeakBytes, memory.m_PeakBytes);
+        return;
+      }
+    }
+    m_Phases.emplace_back(TLoadPhaseStatistics{phase, duration, bytes, elements, memory});
+  }
+
+  inline std::chrono::nanoseconds TLoadStatistics::getDuration() const
+  {
+    std::chrono::nanoseconds duration{0};
+    for (const auto& statistics : m_Phases) {
+      duration += statistics.m_Duration;
+    }
+    return duration;
+  }
+
+  inline void TLoadStatistics::addMemory(const TAllocationStatistics& memory) noexcept
+  {
+    m_Memory.m_Allocations += memory.m_Allocations;
+    m_Memory.m_Bytes += memory.m_Bytes;
+    m_Memory.m_PeakBytes = std::max(m_Memory.m_PeakBytes, memory.m_PeakBytes);
+  }
+}
+
+#endif
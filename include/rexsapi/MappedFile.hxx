@@ -0,0 +1,159 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_MAPPED_FILE_HXX
+#define REXSAPI_MAPPED_FILE_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+
+#include <cstdint>
+#include <filesystem>
+
+#if defined(_WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace rexsapi
+{
+  /**
+   * @brief Read-only memory mapping of a complete file.
+   *
+   * The mapping is shared, so several processes mapping the same file share the physical pages through the page cache.
+   * The file contents are not read until they are accessed.
+   */
+  class TMappedFile
+  {
+  public:
+    explicit TMappedFile(const std::filesystem::path& path);
+
+    ~TMappedFile();
+
+    TMappedFile(const TMappedFile&) = delete;
+    TMappedFile& operator=(const TMappedFile&) = delete;
+
+    TMappedFile(TMappedFile&& other) noexcept
+    : m_Data{other.m_Data}
+    , m_Size{other.m_Size}
+    {
+      other.m_Data = nullptr;
+      other.m_Size = 0;
+    }
+
+    TMappedFile& operator=(TMappedFile&&) = delete;
+
+    [[nodiscard]] const uint8_t* data() const noexcept
+    {
+      return m_Data;
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+  private:
+    const uint8_t* m_Data{nullptr};
+    size_t m_Size{0};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+#if defined(_WIN32)
+
+  inline TMappedFile::TMappedFile(const std::filesystem::path& path)
+  {
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      throw TException{fmt::format("'{}' cannot be opened", path.string())};
+    }
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+      ::CloseHandle(file);
+      throw TException{fmt::format("'{}' is empty or cannot be mapped", path.string())};
+    }
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (mapping == nullptr) {
+      throw TException{fmt::format("'{}' cannot be mapped", path.string())};
+    }
+    // ATTENTION: the view keeps the mapping alive, the handle can be closed right away
+    const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (view == nullptr) {
+      throw TException{fmt::format("'{}' cannot be mapped", path.string())};
+    }
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = static_cast<size_t>(size.QuadPart);
+  }
+
+  inline TMappedFile::~TMappedFile()
+  {
+    if (m_Data) {
+      ::UnmapViewOfFile(m_Data);
+    }
+  }
+
+#else
+
+  inline TMappedFile::TMappedFile(const std::filesystem::path& path)
+  {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw TException{fmt::format("'{}' cannot be opened", path.string())};
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0) {
+      ::close(fd);
+      throw TException{fmt::format("'{}' is empty or cannot be mapped", path.string())};
+    }
+    const auto size = static_cast<size_t>(info.st_size);
+    // ATTENTION: the mapping stays valid after the descriptor has been closed
+    void* view = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+      throw TException{fmt::format("'{}' cannot be mapped", path.string())};
+    }
+    m_Data = static_cast<const uint8_t*>(view);
+    m_Size = size;
+  }
+
+  inline TMappedFile::~TMappedFile()
+  {
+    if (m_Data) {
+      ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+  }
+
+#endif
+}
+
+#endif
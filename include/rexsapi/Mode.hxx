@@ -26,6 +26,24 @@ namespace rexsapi
   enum class TMode { STRICT_MODE, RELAXED_MODE };
   static std::string toModeString(TMode mode);
 
+  /**
+   * @brief Defines when attribute values are decoded while loading a model.
+   *
+   * With LAZY, array and matrix values are decoded and range checked on first access. The loaded document is kept in
+   * memory until all deferred values have been decoded. Issues found while decoding have to be retrieved with
+   * TAttribute::checkValue or checkValues.
+   */
+  enum class TDecodeMode { EAGER, LAZY };
+
+  /**
+   * @brief Defines when a model document is checked against the schema.
+   *
+   * With SEPARATE, the complete document is validated before the model is built. With FUSED, the structural checks run
+   * while the model is built, so the document is traversed only once. Currently, only xml documents can be checked
+   * FUSED, json documents are always validated separately.
+   */
+  enum class TValidationMode { SEPARATE, FUSED };
+
   class TModeAdapter
   {
   public:
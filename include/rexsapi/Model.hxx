@@ -21,6 +21,12 @@
 #include <rexsapi/Relation.hxx>
 #include <rexsapi/RexsVersion.hxx>
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
 namespace rexsapi
 {
   class TModelInfo
@@ -70,6 +76,22 @@ namespace rexsapi
   };
 
 
+  namespace detail
+  {
+    struct TModelIndex {
+      using TComponentRefs = std::vector<const TComponent*>;
+      using TComponentIndex = std::unordered_map<std::string_view, TComponentRefs>;
+
+      explicit TModelIndex(const TComponents& components);
+
+      // ATTENTION: the keys reference the types and attribute ids of the indexed components
+      TComponentIndex m_Types;
+      std::unordered_map<uint64_t, const TComponent*> m_InternalIds;
+      TComponentIndex m_Attributes;
+    };
+  }
+
+
   class TModel
   {
   public:
@@ -81,6 +103,26 @@ namespace rexsapi
     {
     }
 
+    ~TModel() = default;
+
+    /**
+     * @brief Copies the model.
+     *
+     * The relations and load components of the copy reference the copied components and the copy builds its own
+     * index, as the relations, load components and the index of the other model reference its components.
+     */
+    TModel(const TModel& other)
+    : m_Info{other.m_Info}
+    , m_Components{other.m_Components}
+    , m_Relations{copyRelations(other)}
+    , m_Spectrum{copySpectrum(other)}
+    {
+    }
+
+    TModel& operator=(const TModel&) = delete;
+    TModel(TModel&&) noexcept = default;
+    TModel& operator=(TModel&&) noexcept = default;
+
     [[nodiscard]] const TModelInfo& getInfo() const&
     {
       return m_Info;
@@ -101,12 +143,182 @@ namespace rexsapi
       return m_Spectrum;
     }
 
+    /**
+     * @brief Returns the components of a type in model order.
+     *
+     * The queries use indexes that are built on the first query and can be called concurrently.
+     */
+    [[nodiscard]] TComponentRange findComponentsByType(std::string_view type) const;
+
+    [[nodiscard]] const TComponent& findComponentByInternalId(uint64_t id) const;
+
+    /// Returns the components that have an attribute with the given id in model order
+    [[nodiscard]] TComponentRange findComponentsWithAttribute(std::string_view attributeId) const;
+
   private:
+    /// Returns the copied component at the position of the component in the other model
+    const TComponent& rebind(const TModel& other, const TComponent& component) const;
+
+    TRelations copyRelations(const TModel& other) const;
+
+    TLoadComponents copyLoadComponents(const TModel& other, const TLoadComponents& loadComponents) const;
+
+    TLoadSpectrum copySpectrum(const TModel& other) const;
+
+    const detail::TModelIndex& getIndex() const;
+
+    static TComponentRange toRange(const detail::TModelIndex::TComponentIndex& index, std::string_view key);
+
     TModelInfo m_Info;
     TComponents m_Components;
     TRelations m_Relations;
     TLoadSpectrum m_Spectrum;
+    mutable std::shared_ptr<const detail::TModelIndex> m_Index;
   };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline detail::TModelIndex::TModelIndex(const TComponents& components)
+  {
+    m_InternalIds.reserve(components.size());
+    for (const auto& component : components) {
+      m_Types[component.getType()].emplace_back(&component);
+      m_InternalIds.try_emplace(component.getInternalId(), &component);
+      for (const auto& attribute : component.getAttributes()) {
+        auto& refs = m_Attributes[attribute.getAttributeId()];
+        if (refs.empty() || refs.back() != &component) {
+          refs.emplace_back(&component);
+        }
+      }
+    }
+  }
+
+  inline const TComponent& TModel::rebind(const TModel& other, const TComponent& component) const
+  {
+    const auto* components = other.m_Components.data();
+    const std::less<const TComponent*> less;
+    if (less(&component, components) || !less(&component, components + other.m_Components.size())) {
+      throw TException{
+        fmt::format("component with internal id {} is not part of the copied model", component.getInternalId())};
+    }
+    return m_Components[static_cast<size_t>(&component - components)];
+  }
+
+  inline TRelations TModel::copyRelations(const TModel& other) const
+  {
+    TRelations relations;
+    relations.reserve(other.m_Relations.size());
+    for (const auto& relation : other.m_Relations) {
+      TRelationReferences references;
+      references.reserve(relation.getReferences().size());
+      for (const auto& reference : relation.getReferences()) {
+        references.emplace_back(
+          TRelationReference{reference.getRole(), reference.getHint(), rebind(other, reference.getComponent())});
+      }
+      relations.emplace_back(TRelation{relation.getType(), relation.getOrder(), std::move(references)});
+    }
+    return relations;
+  }
+
+  inline TLoadComponents TModel::copyLoadComponents(const TModel& other, const TLoadComponents& loadComponents) const
+  {
+    TLoadComponents copies;
+    copies.reserve(loadComponents.size());
+    for (const auto& loadComponent : loadComponents) {
+      copies.emplace_back(
+        TLoadComponent{rebind(other, loadComponent.getComponent()), loadComponent.getLoadAttributes()});
+    }
+    return copies;
+  }
+
+  inline TLoadSpectrum TModel::copySpectrum(const TModel& other) const
+  {
+    const auto& spectrum = other.m_Spectrum;
+    TLoadCases loadCases;
+    loadCases.reserve(spectrum.getLoadCases().size());
+    for (const auto& loadCase : spectrum.getLoadCases()) {
+      loadCases.emplace_back(TLoadCase{copyLoadComponents(other, loadCase.getLoadComponents())});
+    }
+    std::optional<TAccumulation> accumulation;
+    if (spectrum.hasAccumulation()) {
+      accumulation = TAccumulation{copyLoadComponents(other, spectrum.getAccumulation().getLoadComponents())};
+    }
+    return TLoadSpectrum{std::move(loadCases), std::move(accumulation)};
+  }
+
+  inline TComponentRange TModel::findComponentsByType(std::string_view type) const
+  {
+    return toRange(getIndex().m_Types, type);
+  }
+
+  inline const TComponent& TModel::findComponentByInternalId(uint64_t id) const
+  {
+    const auto& ids = getIndex().m_InternalIds;
+    const auto it = ids.find(id);
+    if (it == ids.end()) {
+      throw TException{fmt::format("component with internal id {} not found", id)};
+    }
+    return *it->second;
+  }
+
+  inline TComponentRange TModel::findComponentsWithAttribute(std::string_view attributeId) const
+  {
+    return toRange(getIndex().m_Attributes, attributeId);
+  }
+
+  inline const detail::TModelIndex& TModel::getIndex() const
+  {
+    auto index = std::atomic_load(&m_Index);
+    if (!index) {
+      // concurrent first queries may build the index more than once, but only one index is kept
+      std::shared_ptr<const detail::TModelIndex> created = std::make_shared<detail::TModelIndex>(m_Components);
+      if (std::atomic_compare_exchange_strong(&m_Index, &index, created)) {
+        index = std::move(created);
+      }
+    }
+    return *index;
+  }
+
+  inline TComponentRange TModel::toRange(const detail::TModelIndex::TComponentIndex& index, std::string_view key)
+  {
+    const auto it = index.find(key);
+    if (it == index.end()) {
+      return TComponentRange{};
+    }
+    return TComponentRange{it->second.data(), it->second.size()};
+  }
+
+
+  /**
+   * @brief Decodes all deferred values of a model and adds the issues found while decoding to the result.
+   *
+   * Only necessary for models loaded with TDecodeMode::LAZY, which defers value checks until values are accessed.
+   */
+  static inline void checkValues(TResult& result, const TModel& model)
+  {
+    const auto check = [&result](const TAttributes& attributes) {
+      for (const auto& attribute : attributes) {
+        attribute.checkValue(result);
+      }
+    };
+
+    for (const auto& component : model.getComponents()) {
+      check(component.getAttributes());
+    }
+    for (const auto& loadCase : model.getLoadSpectrum().getLoadCases()) {
+      for (const auto& loadComponent : loadCase.getLoadComponents()) {
+        check(loadComponent.getLoadAttributes());
+      }
+    }
+    if (model.getLoadSpectrum().hasAccumulation()) {
+      for (const auto& loadComponent : model.getLoadSpectrum().getAccumulation().getLoadComponents()) {
+        check(loadComponent.getLoadAttributes());
+      }
+    }
+  }
 }
 
 #endif
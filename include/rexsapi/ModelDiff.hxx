@@ -0,0 +1,543 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_MODEL_DIFF_HXX
+#define REXSAPI_MODEL_DIFF_HXX
+
+#include <rexsapi/Hash.hxx>
+#include <rexsapi/Model.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+namespace rexsapi
+{
+  enum class TDiffType {
+    ADDED,    ///< Only in the new model
+    REMOVED,  ///< Only in the old model
+    CHANGED   ///< In both models with different content
+  };
+
+  static std::string toDiffTypeString(TDiffType type);
+
+
+  struct TAttributeDifference {
+    TDiffType m_Type;
+    /// nullptr for added attributes
+    const TAttribute* m_Old;
+    /// nullptr for removed attributes
+    const TAttribute* m_New;
+
+    [[nodiscard]] const std::string& getAttributeId() const&
+    {
+      return m_Old ? m_Old->getAttributeId() : m_New->getAttributeId();
+    }
+  };
+
+
+  struct TComponentDifference {
+    TDiffType m_Type;
+    /// The key the components have been matched by
+    std::string m_Key;
+    /// nullptr for added components
+    const TComponent* m_Old;
+    /// nullptr for removed components
+    const TComponent* m_New;
+    /// The attribute differences of changed components
+    std::vector<TAttributeDifference> m_Attributes;
+  };
+
+
+  struct TRelationDifference {
+    TDiffType m_Type;
+    /// The key the relations have been matched by
+    std::string m_Key;
+    /// nullptr for added relations
+    const TRelation* m_Old;
+    /// nullptr for removed relations
+    const TRelation* m_New;
+  };
+
+
+  struct TModelDiffOptions {
+    /// Floating point values a and b are equal if |a - b| <= max(absolute, relative * max(|a|, |b|))
+    double m_AbsoluteTolerance{0.0};
+    double m_RelativeTolerance{0.0};
+    /// Returns the key components are matched by, type and name if empty
+    std::function<std::string(const TComponent&)> m_Key;
+  };
+
+
+  namespace detail
+  {
+    /**
+     * @brief Keys, internal id lookup and content hashes of the components of one model.
+     */
+    class TDiffModel
+    {
+    public:
+      TDiffModel(const TModel& model, const std::function<std::string(const TComponent&)>& key);
+
+      [[nodiscard]] const TComponents& getComponents() const&
+      {
+        return m_Model.getComponents();
+      }
+
+      [[nodiscard]] const std::string& getKey(size_t index) const&
+      {
+        return m_Keys[index];
+      }
+
+      /**
+       * @brief Returns the key of a component referenced by a relation.
+       *
+       * @throws TException if the model has no component with the internal id of the component
+       */
+      [[nodiscard]] const std::string& getKey(const TComponent& component) const&;
+
+      /// Returns the key of the component with the internal id or an empty string for unknown ids
+      [[nodiscard]] std::string getReferencedKey(int64_t internalId) const;
+
+      [[nodiscard]] uint64_t getHash(size_t index) const noexcept
+      {
+        return m_Hashes[index];
+      }
+
+    private:
+      uint64_t hashComponent(const TComponent& component) const;
+
+      uint64_t hashAttribute(const TAttribute& attribute) const;
+
+      const TModel& m_Model;
+      std::vector<std::string> m_Keys;
+      std::unordered_map<uint64_t, size_t> m_Ids;
+      std::vector<uint64_t> m_Hashes;
+    };
+  }
+
+
+  /**
+   * @brief Differences of the components, attributes and relations of two models.
+   *
+   * Components are matched by a key, which defaults to the type and the name of a component. Components with the same
+   * key are matched in model order and get a #2, #3, ... suffix, which is incremented further if the suffixed key is
+   * already taken by another component. Matching uses hash maps, so the diff takes linear time in the size of the models.
+   * Matched components with the same content hash are considered equal without comparing their attributes.
+   * Attributes are matched by their id, reference component values are compared by the keys of the referenced
+   * components, so renumbered components do not show up as changed.
+   *
+   * Relations are matched by their type and the roles and keys of their referenced components. Matched relations with
+   * a different order or different hints are reported as changed.
+   *
+   * The diff references the components and relations of the models, so the models have to outlive the diff.
+   */
+  class TModelDiff
+  {
+  public:
+    TModelDiff(const TModel& oldModel, const TModel& newModel, TModelDiffOptions options = {});
+
+    /// True if the models do not differ
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return m_Components.empty() && m_Relations.empty();
+    }
+
+    /// Removed and changed components in old model order, followed by added components in new model order
+    [[nodiscard]] const std::vector<TComponentDifference>& getComponents() const&
+    {
+      return m_Components;
+    }
+
+    /// Removed and changed relations in old model order, followed by added relations in new model order
+    [[nodiscard]] const std::vector<TRelationDifference>& getRelations() const&
+    {
+      return m_Relations;
+    }
+
+  private:
+    void diffComponents(const detail::TDiffModel& oldModel, const detail::TDiffModel& newModel);
+
+    std::vector<TAttributeDifference> diffAttributes(const detail::TDiffModel& oldModel, const TComponent& oldComponent,
+                                                     const detail::TDiffModel& newModel,
+                                                     const TComponent& newComponent) const;
+
+    bool isEqual(const detail::TDiffModel& oldModel, const TAttribute& oldAttribute, const detail::TDiffModel& newModel,
+                 const TAttribute& newAttribute) const;
+
+    bool isEqual(double lhs, double rhs) const noexcept;
+
+    void diffRelations(const TModel& oldModel, const detail::TDiffModel& oldDiffModel, const TModel& newModel,
+                       const detail::TDiffModel& newDiffModel);
+
+    TModelDiffOptions m_Options;
+    std::vector<TComponentDifference> m_Components;
+    std::vector<TRelationDifference> m_Relations;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  static inline std::string toDiffTypeString(TDiffType type)
+  {
+    switch (type) {
+      case TDiffType::ADDED:
+        return "added";
+      case TDiffType::REMOVED:
+        return "removed";
+      case TDiffType::CHANGED:
+        return "changed";
+    }
+    throw TException{"unknown diff type"};
+  }
+
+  namespace detail
+  {
+    static inline uint64_t diffHash(uint64_t hash, std::string_view s) noexcept
+    {
+      // hash the size as well, so concatenated strings do not collide
+      const uint64_t size = s.size();
+      return fnv1a(fnv1a(hash, &size, sizeof(size)), s.data(), s.size());
+    }
+
+    static inline uint64_t diffHash(uint64_t hash, double d) noexcept
+    {
+      // -0.0 and 0.0 compare equal and have to hash equal
+      if (std::fpclassify(d) == FP_ZERO) {
+        d = 0.0;
+      }
+      return fnv1a(hash, &d, sizeof(d));
+    }
+
+    static inline uint64_t diffHash(uint64_t hash, int64_t i) noexcept
+    {
+      return fnv1a(hash, &i, sizeof(i));
+    }
+
+    static inline uint64_t diffHash(uint64_t hash, bool b) noexcept
+    {
+      const unsigned char c = b ? 1 : 0;
+      return fnv1a(hash, &c, sizeof(c));
+    }
+
+    static inline uint64_t diffHash(uint64_t hash, const Bool& b) noexcept
+    {
+      return diffHash(hash, *b);
+    }
+
+    template<typename T>
+    static inline uint64_t diffHash(uint64_t hash, const std::vector<T>& values) noexcept
+    {
+      hash = diffHash(hash, static_cast<int64_t>(values.size()));
+      for (const auto& value : values) {
+        hash = diffHash(hash, value);
+      }
+      return hash;
+    }
+
+    template<typename T>
+    static inline uint64_t diffHash(uint64_t hash, const TMatrix<T>& matrix) noexcept
+    {
+      return diffHash(hash, matrix.m_Values);
+    }
+
+    /**
+     * @brief Returns the key or, if it has already been used, the key with the next free #n suffix.
+     *
+     * Keys maps every returned key to the last suffix tried for it, so a suffixed duplicate never collides with a key
+     * that literally ends with the same suffix, regardless of which one comes first.
+     */
+    static inline std::string uniqueKey(std::unordered_map<std::string, size_t>& keys, std::string key)
+    {
+      auto [it, inserted] = keys.try_emplace(key, 1);
+      if (inserted) {
+        return key;
+      }
+      auto count = it->second;
+      std::string suffixed;
+      do {
+        suffixed = fmt::format("{}#{}", key, ++count);
+      } while (keys.find(suffixed) != keys.end());
+      it->second = count;
+      keys.emplace(suffixed, 1);
+      return suffixed;
+    }
+
+    inline TDiffModel::TDiffModel(const TModel& model, const std::function<std::string(const TComponent&)>& key)
+    : m_Model{model}
+    {
+      const auto& components = model.getComponents();
+      m_Keys.reserve(components.size());
+      m_Ids.reserve(components.size());
+      std::unordered_map<std::string, size_t> keys;
+      for (size_t n = 0; n < components.size(); ++n) {
+        const auto& component = components[n];
+        // components with the same key are matched in model order
+        m_Keys.emplace_back(
+          uniqueKey(keys, key ? key(component) : fmt::format("{}/{}", component.getType(), component.getName())));
+        m_Ids.emplace(component.getInternalId(), n);
+      }
+
+      m_Hashes.reserve(components.size());
+      for (const auto& component : components) {
+        m_Hashes.emplace_back(hashComponent(component));
+      }
+    }
+
+    inline const std::string& TDiffModel::getKey(const TComponent& component) const&
+    {
+      // relations may reference components outside of the model, so they are looked up by their internal id
+      const auto it = m_Ids.find(component.getInternalId());
+      if (it == m_Ids.end()) {
+        throw TException{fmt::format("component id={} is not part of the model", component.getInternalId())};
+      }
+      return m_Keys[it->second];
+    }
+
+    inline std::string TDiffModel::getReferencedKey(int64_t internalId) const
+    {
+      const auto it = m_Ids.find(static_cast<uint64_t>(internalId));
+      return it != m_Ids.end() ? m_Keys[it->second] : std::string{};
+    }
+
+    inline uint64_t TDiffModel::hashComponent(const TComponent& component) const
+    {
+      auto hash = diffHash(diffHash(Fnv1aOffsetBasis, component.getType()), component.getName());
+      // attributes are summed up, so the hash does not depend on the order of the attributes
+      uint64_t attributes = 0;
+      for (const auto& attribute : component.getAttributes()) {
+        attributes += hashAttribute(attribute);
+      }
+      return fnv1a(hash, &attributes, sizeof(attributes));
+    }
+
+    inline uint64_t TDiffModel::hashAttribute(const TAttribute& attribute) const
+    {
+      auto hash = diffHash(diffHash(Fnv1aOffsetBasis, attribute.getAttributeId()), attribute.getUnit().getName());
+      const auto type = static_cast<unsigned char>(attribute.getValueType());
+      hash = fnv1a(hash, &type, sizeof(type));
+      const auto& value = attribute.getValue();
+      if (value.isEmpty()) {
+        return hash;
+      }
+      if (attribute.getValueType() == TValueType::REFERENCE_COMPONENT) {
+        return diffHash(hash, getReferencedKey(value.getValue<TReferenceComponentType>()));
+      }
+      return rexsapi::visit<uint64_t>(attribute.getValueType(), value, [hash](auto, const auto& v) -> uint64_t {
+        return diffHash(hash, v);
+      });
+    }
+  }
+
+  inline TModelDiff::TModelDiff(const TModel& oldModel, const TModel& newModel, TModelDiffOptions options)
+  : m_Options{std::move(options)}
+  {
+    const detail::TDiffModel oldDiffModel{oldModel, m_Options.m_Key};
+    const detail::TDiffModel newDiffModel{newModel, m_Options.m_Key};
+    diffComponents(oldDiffModel, newDiffModel);
+    diffRelations(oldModel, oldDiffModel, newModel, newDiffModel);
+  }
+
+  inline void TModelDiff::diffComponents(const detail::TDiffModel& oldModel, const detail::TDiffModel& newModel)
+  {
+    const auto& oldComponents = oldModel.getComponents();
+    const auto& newComponents = newModel.getComponents();
+
+    std::unordered_map<std::string_view, size_t> newKeys;
+    newKeys.reserve(newComponents.size());
+    for (size_t n = 0; n < newComponents.size(); ++n) {
+      newKeys.emplace(newModel.getKey(n), n);
+    }
+
+    std::vector<bool> matched(newComponents.size(), false);
+    for (size_t n = 0; n < oldComponents.size(); ++n) {
+      const auto it = newKeys.find(oldModel.getKey(n));
+      if (it == newKeys.end()) {
+        m_Components.emplace_back(
+          TComponentDifference{TDiffType::REMOVED, oldModel.getKey(n), &oldComponents[n], nullptr, {}});
+        continue;
+      }
+      matched[it->second] = true;
+      if (oldModel.getHash(n) == newModel.getHash(it->second)) {
+        continue;
+      }
+      const auto& oldComponent = oldComponents[n];
+      const auto& newComponent = newComponents[it->second];
+      auto attributes = diffAttributes(oldModel, oldComponent, newModel, newComponent);
+      if (!attributes.empty() || oldComponent.getType() != newComponent.getType() ||
+          oldComponent.getName() != newComponent.getName()) {
+        m_Components.emplace_back(TComponentDifference{TDiffType::CHANGED, oldModel.getKey(n), &oldComponent,
+                                                       &newComponent, std::move(attributes)});
+      }
+    }
+
+    for (size_t n = 0; n < newComponents.size(); ++n) {
+      if (!matched[n]) {
+        m_Components.emplace_back(
+          TComponentDifference{TDiffType::ADDED, newModel.getKey(n), nullptr, &newComponents[n], {}});
+      }
+    }
+  }
+
+  inline std::vector<TAttributeDifference>
+  TModelDiff::diffAttributes(const detail::TDiffModel& oldModel, const TComponent& oldComponent,
+                             const detail::TDiffModel& newModel, const TComponent& newComponent) const
+  {
+    std::vector<TAttributeDifference> differences;
+    for (const auto& oldAttribute : oldComponent.getAttributes()) {
+      const auto* newAttribute = newComponent.findAttribute(oldAttribute.getAttributeId());
+      if (newAttribute == nullptr) {
+        differences.emplace_back(TAttributeDifference{TDiffType::REMOVED, &oldAttribute, nullptr});
+      } else if (!isEqual(oldModel, oldAttribute, newModel, *newAttribute)) {
+        differences.emplace_back(TAttributeDifference{TDiffType::CHANGED, &oldAttribute, newAttribute});
+      }
+    }
+    for (const auto& newAttribute : newComponent.getAttributes()) {
+      if (oldComponent.findAttribute(newAttribute.getAttributeId()) == nullptr) {
+        differences.emplace_back(TAttributeDifference{TDiffType::ADDED, nullptr, &newAttribute});
+      }
+    }
+    return differences;
+  }
+
+  inline bool TModelDiff::isEqual(const detail::TDiffModel& oldModel, const TAttribute& oldAttribute,
+                                  const detail::TDiffModel& newModel, const TAttribute& newAttribute) const
+  {
+    if (oldAttribute.getValueType() != newAttribute.getValueType() ||
+        !(oldAttribute.getUnit() == newAttribute.getUnit())) {
+      return false;
+    }
+    const auto& oldValue = oldAttribute.getValue();
+    const auto& newValue = newAttribute.getValue();
+    if (oldValue.isEmpty() || newValue.isEmpty()) {
+      return oldValue.isEmpty() && newValue.isEmpty();
+    }
+
+    const auto isEqualArray = [this](const std::vector<double>& lhs, const std::vector<double>& rhs) {
+      return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [this](double l, double r) {
+               return isEqual(l, r);
+             });
+    };
+
+    switch (oldAttribute.getValueType()) {
+      case TValueType::FLOATING_POINT:
+        return isEqual(oldValue.getValue<TFloatType>(), newValue.getValue<TFloatType>());
+      case TValueType::FLOATING_POINT_ARRAY:
+        return isEqualArray(oldValue.getValue<TFloatArrayType>(), newValue.getValue<TFloatArrayType>());
+      case TValueType::FLOATING_POINT_MATRIX: {
+        const auto& lhs = oldValue.getValue<TFloatMatrixType>().m_Values;
+        const auto& rhs = newValue.getValue<TFloatMatrixType>().m_Values;
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), isEqualArray);
+      }
+      case TValueType::REFERENCE_COMPONENT:
+        return oldModel.getReferencedKey(oldValue.getValue<TReferenceComponentType>()) ==
+               newModel.getReferencedKey(newValue.getValue<TReferenceComponentType>());
+      default:
+        return oldValue == newValue;
+    }
+  }
+
+  inline bool TModelDiff::isEqual(double lhs, double rhs) const noexcept
+  {
+    if (std::isnan(lhs) || std::isnan(rhs)) {
+      return std::isnan(lhs) && std::isnan(rhs);
+    }
+    const auto tolerance =
+      std::max(m_Options.m_AbsoluteTolerance, m_Options.m_RelativeTolerance * std::max(std::abs(lhs), std::abs(rhs)));
+    return std::abs(lhs - rhs) <= tolerance;
+  }
+
+  inline void TModelDiff::diffRelations(const TModel& oldModel, const detail::TDiffModel& oldDiffModel,
+                                        const TModel& newModel, const detail::TDiffModel& newDiffModel)
+  {
+    // relations are keyed by their type and the sorted roles and keys of their references
+    const auto createKeys = [](const TModel& model, const detail::TDiffModel& diffModel) {
+      std::vector<std::string> keys;
+      keys.reserve(model.getRelations().size());
+      std::unordered_map<std::string, size_t> uniqueKeys;
+      std::vector<std::string> references;
+      for (const auto& relation : model.getRelations()) {
+        references.clear();
+        for (const auto& reference : relation.getReferences()) {
+          references.emplace_back(fmt::format("{}={}", toRelationRoleString(reference.getRole()),
+                                              diffModel.getKey(reference.getComponent())));
+        }
+        std::sort(references.begin(), references.end());
+        auto key = toRealtionTypeString(relation.getType());
+        for (size_t n = 0; n < references.size(); ++n) {
+          key += (n == 0 ? "[" : ", ") + references[n];
+        }
+        key += "]";
+        keys.emplace_back(detail::uniqueKey(uniqueKeys, std::move(key)));
+      }
+      return keys;
+    };
+
+    const auto oldKeys = createKeys(oldModel, oldDiffModel);
+    const auto newKeys = createKeys(newModel, newDiffModel);
+    const auto& oldRelations = oldModel.getRelations();
+    const auto& newRelations = newModel.getRelations();
+
+    std::unordered_map<std::string_view, size_t> newIndex;
+    newIndex.reserve(newKeys.size());
+    for (size_t n = 0; n < newKeys.size(); ++n) {
+      newIndex.emplace(newKeys[n], n);
+    }
+
+    const auto isEqualRelation = [&oldDiffModel, &newDiffModel](const TRelation& lhs, const TRelation& rhs) {
+      if (lhs.getOrder() != rhs.getOrder()) {
+        return false;
+      }
+      // the references are equal by key, only the hints can differ
+      for (const auto& reference : lhs.getReferences()) {
+        const auto& key = oldDiffModel.getKey(reference.getComponent());
+        const auto it = std::find_if(rhs.getReferences().begin(), rhs.getReferences().end(), [&](const auto& other) {
+          return other.getRole() == reference.getRole() && newDiffModel.getKey(other.getComponent()) == key &&
+                 other.getHint() == reference.getHint();
+        });
+        if (it == rhs.getReferences().end()) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    std::vector<bool> matched(newRelations.size(), false);
+    for (size_t n = 0; n < oldRelations.size(); ++n) {
+      const auto it = newIndex.find(oldKeys[n]);
+      if (it == newIndex.end()) {
+        m_Relations.emplace_back(TRelationDifference{TDiffType::REMOVED, oldKeys[n], &oldRelations[n], nullptr});
+        continue;
+      }
+      matched[it->second] = true;
+      if (!isEqualRelation(oldRelations[n], newRelations[it->second])) {
+        m_Relations.emplace_back(
+          TRelationDifference{TDiffType::CHANGED, oldKeys[n], &oldRelations[n], &newRelations[it->second]});
+      }
+    }
+
+    for (size_t n = 0; n < newRelations.size(); ++n) {
+      if (!matched[n]) {
+        m_Relations.emplace_back(TRelationDifference{TDiffType::ADDED, newKeys[n], nullptr, &newRelations[n]});
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,350 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_MODEL_GENERATOR_HXX
+#define REXSAPI_MODEL_GENERATOR_HXX
+
+#include <rexsapi/ModelBuilder.hxx>
+#include <rexsapi/Version.hxx>
+
+#include <array>
+#include <random>
+#include <unordered_map>
+
+namespace rexsapi
+{
+  struct TModelGeneratorOptions {
+    /// The component types to cycle through, all types have to exist in the database model
+    std::vector<std::string> m_ComponentTypes{"gear_unit", "gear_casing",     "shaft", "cylindrical_gear",
+                                              "lubricant", "concept_bearing", "material"};
+    size_t m_Components{100};
+    /// Attributes beyond the database attributes of a component type are added as custom attributes
+    size_t m_AttributesPerComponent{20};
+    /// At least the number of relations necessary to use all components will be added, never self references
+    size_t m_Relations{0};
+    size_t m_ArraySize{16};
+    /// Matrices are square
+    size_t m_MatrixSize{4};
+    TCodeType m_CodeType{TCodeType::None};
+    size_t m_LoadCases{0};
+    uint64_t m_Seed{0};
+  };
+
+
+  /**
+   * @brief Generates synthetic models of arbitrary size with the TComponentBuilder and TLoadCaseBuilder.
+   *
+   * Components cycle through the configured component types and are connected by reference relations to a random
+   * tree. A model with a single component has no relations. Each component gets the database attributes of its type in database order, except reference component
+   * attributes, topped up with custom attributes. Load cases contain all components with their floating point
+   * attributes. The same options and database model always generate the same model on all platforms, only the model
+   * date differs.
+   */
+  class TModelGenerator
+  {
+  public:
+    TModelGenerator(const database::TModel& databaseModel, TModelGeneratorOptions options);
+
+    [[nodiscard]] TModel generate() const;
+
+  private:
+    using TAttributeRefs = std::vector<std::reference_wrapper<const database::TAttribute>>;
+
+    TValue createValue(TValueType type, const database::TAttribute* attribute, std::mt19937_64& engine) const;
+
+    TCodeType getCodeType(TValueType type) const;
+
+    static double createFloat(const database::TAttribute* attribute, std::mt19937_64& engine);
+
+    static int64_t createInt(const database::TAttribute* attribute, std::mt19937_64& engine);
+
+    static std::string createString(std::mt19937_64& engine);
+
+    static std::string createEnum(const database::TAttribute& attribute, std::mt19937_64& engine);
+
+    const database::TModel& m_DatabaseModel;
+    TModelGeneratorOptions m_Options;
+    std::unordered_map<std::string, TAttributeRefs> m_Attributes;
+    std::unordered_map<std::string, TAttributeRefs> m_LoadAttributes;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  namespace detail
+  {
+    /// Maps the engine output to [lo, hi), unlike std::uniform_real_distribution the same on all platforms
+    inline double generateFloat(std::mt19937_64& engine, double lo, double hi)
+    {
+      // the upper 53 bits fill the mantissa of a double in [0, 1)
+      return lo + static_cast<double>(engine() >> 11) * 0x1p-53 * (hi - lo);
+    }
+
+    /// Maps the engine output to [lo, hi], unlike std::uniform_int_distribution the same on all platforms
+    inline int64_t generateInt(std::mt19937_64& engine, int64_t lo, int64_t hi)
+    {
+      // the modulo bias is negligible for small ranges
+      return lo + static_cast<int64_t>(engine() % static_cast<uint64_t>(hi - lo + 1));
+    }
+  }
+
+  inline TModelGenerator::TModelGenerator(const database::TModel& databaseModel, TModelGeneratorOptions options)
+  : m_DatabaseModel{databaseModel}
+  , m_Options{std::move(options)}
+  {
+    if (m_Options.m_ComponentTypes.empty()) {
+      throw TException{"no component types specified for model generator"};
+    }
+    for (const auto& type : m_Options.m_ComponentTypes) {
+      auto& attributes = m_Attributes[type];
+      auto& loadAttributes = m_LoadAttributes[type];
+      for (const auto& attribute : m_DatabaseModel.findComponentById(type).getAttributes()) {
+        if (attribute.get().getValueType() == TValueType::REFERENCE_COMPONENT) {
+          continue;
+        }
+        if (attributes.size() < m_Options.m_AttributesPerComponent) {
+          attributes.emplace_back(attribute);
+          if (attribute.get().getValueType() == TValueType::FLOATING_POINT) {
+            loadAttributes.emplace_back(attribute);
+          }
+        }
+      }
+    }
+  }
+
+  inline TModel TModelGenerator::generate() const
+  {
+    static constexpr std::array<TValueType, 5> customTypes{
+      TValueType::FLOATING_POINT, TValueType::FLOATING_POINT_ARRAY, TValueType::INTEGER_ARRAY,
+      TValueType::FLOATING_POINT_MATRIX, TValueType::STRING};
+    if (m_Options.m_Components == 0) {
+      throw TException{"no components specified for model generator"};
+    }
+
+    std::mt19937_64 engine{m_Options.m_Seed};
+    TComponentBuilder builder{m_DatabaseModel};
+    std::vector<TComponentId> ids;
+    ids.reserve(m_Options.m_Components);
+
+    for (size_t n = 0; n < m_Options.m_Components; ++n) {
+      const auto& type = m_Options.m_ComponentTypes[n % m_Options.m_ComponentTypes.size()];
+      builder.addComponent(type).name(fmt::format("{} {}", type, n));
+      ids.emplace_back(builder.id());
+      const auto& attributes = m_Attributes.at(type);
+      for (const auto& attribute : attributes) {
+        builder.addAttribute(attribute.get().getAttributeId())
+          .value(createValue(attribute.get().getValueType(), &attribute.get(), engine))
+          .coded(getCodeType(attribute.get().getValueType()));
+      }
+      for (size_t m = attributes.size(); m < m_Options.m_AttributesPerComponent; ++m) {
+        const auto customType = customTypes[m % customTypes.size()];
+        builder.addCustomAttribute(fmt::format("custom_attribute_{}", m), customType)
+          .value(createValue(customType, nullptr, engine))
+          .coded(getCodeType(customType));
+      }
+    }
+    auto components = builder.build();
+
+    // the TModelBuilder rejects models without relations, but a model with a single component has none. The component
+    // builder numbers the components in insertion order, so they can be referenced by index.
+    TRelations relations;
+    const auto addReference = [&components, &relations](size_t origin, size_t referenced) {
+      relations.emplace_back(
+        TRelation{TRelationType::REFERENCE,
+                  {},
+                  TRelationReferences{TRelationReference{TRelationRole::ORIGIN, "", components[origin]},
+                                      TRelationReference{TRelationRole::REFERENCED, "", components[referenced]}}});
+    };
+    for (size_t n = 1; n < components.size(); ++n) {
+      addReference(engine() % n, n);
+    }
+    for (size_t n = components.size() - 1; n < m_Options.m_Relations && components.size() > 1; ++n) {
+      const auto origin = engine() % components.size();
+      addReference(origin, (origin + 1 + engine() % (components.size() - 1)) % components.size());
+    }
+
+    TLoadCases loadCases;
+    for (size_t n = 0; n < m_Options.m_LoadCases; ++n) {
+      TLoadCaseBuilder loadCaseBuilder{m_DatabaseModel};
+      for (size_t m = 0; m < ids.size(); ++m) {
+        const auto& type = m_Options.m_ComponentTypes[m % m_Options.m_ComponentTypes.size()];
+        const auto& attributes = m_LoadAttributes.at(type);
+        if (attributes.empty()) {
+          continue;
+        }
+        loadCaseBuilder.addComponent(ids[m]);
+        for (const auto& attribute : attributes) {
+          loadCaseBuilder.addAttribute(attribute.get().getAttributeId())
+            .value(createValue(TValueType::FLOATING_POINT, &attribute.get(), engine));
+        }
+      }
+      auto loadCase = loadCaseBuilder.build(components, builder);
+      if (!loadCase.getLoadComponents().empty()) {
+        loadCases.emplace_back(std::move(loadCase));
+      }
+    }
+
+    TModelInfo info{"REXSapi Model Generator", REXSAPI_VERSION_STRING,
+                    getTimeStringISO8601(std::chrono::system_clock::now()), m_DatabaseModel.getVersion(),
+                    m_DatabaseModel.getLanguage()};
+    return TModel{std::move(info), std::move(components), std::move(relations),
+                  TLoadSpectrum{std::move(loadCases), {}}};
+  }
+
+  inline TValue TModelGenerator::createValue(TValueType type, const database::TAttribute* attribute,
+                                             std::mt19937_64& engine) const
+  {
+    const auto arraySize = m_Options.m_ArraySize;
+    const auto matrixSize = m_Options.m_MatrixSize;
+
+    switch (type) {
+      case TValueType::FLOATING_POINT:
+        return TValue{createFloat(attribute, engine)};
+      case TValueType::BOOLEAN:
+        return TValue{Bool{(engine() & 1) != 0}};
+      case TValueType::INTEGER:
+        return TValue{createInt(attribute, engine)};
+      case TValueType::ENUM:
+        return TValue{createEnum(*attribute, engine)};
+      case TValueType::STRING:
+      case TValueType::FILE_REFERENCE:
+        return TValue{createString(engine)};
+      case TValueType::FLOATING_POINT_ARRAY: {
+        TFloatArrayType array(arraySize);
+        for (auto& element : array) {
+          element = createFloat(attribute, engine);
+        }
+        return TValue{std::move(array)};
+      }
+      case TValueType::BOOLEAN_ARRAY: {
+        TBoolArrayType array(arraySize);
+        for (auto& element : array) {
+          element = Bool{(engine() & 1) != 0};
+        }
+        return TValue{std::move(array)};
+      }
+      case TValueType::INTEGER_ARRAY: {
+        TIntArrayType array(arraySize);
+        for (auto& element : array) {
+          element = createInt(attribute, engine);
+        }
+        return TValue{std::move(array)};
+      }
+      case TValueType::STRING_ARRAY: {
+        TStringArrayType array(arraySize);
+        for (auto& element : array) {
+          element = createString(engine);
+        }
+        return TValue{std::move(array)};
+      }
+      case TValueType::ENUM_ARRAY: {
+        TEnumArrayType array(arraySize);
+        for (auto& element : array) {
+          element = createEnum(*attribute, engine);
+        }
+        return TValue{std::move(array)};
+      }
+      case TValueType::FLOATING_POINT_MATRIX: {
+        std::vector<std::vector<double>> matrix(matrixSize, std::vector<double>(matrixSize));
+        for (auto& row : matrix) {
+          for (auto& element : row) {
+            element = createFloat(attribute, engine);
+          }
+        }
+        return TValue{TFloatMatrixType{std::move(matrix)}};
+      }
+      case TValueType::STRING_MATRIX: {
+        std::vector<std::vector<std::string>> matrix(matrixSize, std::vector<std::string>(matrixSize));
+        for (auto& row : matrix) {
+          for (auto& element : row) {
+            element = createString(engine);
+          }
+        }
+        return TValue{TStringMatrixType{std::move(matrix)}};
+      }
+      case TValueType::ARRAY_OF_INTEGER_ARRAYS: {
+        TArrayOfIntArraysType arrays(matrixSize);
+        for (auto& array : arrays) {
+          array.resize(1 + engine() % std::max<size_t>(arraySize, 1));
+          for (auto& element : array) {
+            element = createInt(attribute, engine);
+          }
+        }
+        return TValue{std::move(arrays)};
+      }
+      case TValueType::REFERENCE_COMPONENT:
+        break;
+    }
+    throw TException{fmt::format("cannot generate value of type {}", toTypeString(type))};
+  }
+
+  inline TCodeType TModelGenerator::getCodeType(TValueType type) const
+  {
+    // only numeric arrays and matrices can be coded
+    switch (type) {
+      case TValueType::FLOATING_POINT_ARRAY:
+      case TValueType::INTEGER_ARRAY:
+      case TValueType::FLOATING_POINT_MATRIX:
+        return m_Options.m_CodeType;
+      default:
+        return TCodeType::None;
+    }
+  }
+
+  inline double TModelGenerator::createFloat(const database::TAttribute* attribute, std::mt19937_64& engine)
+  {
+    const auto value = detail::generateFloat(engine, 0.5, 100.0);
+    if (attribute == nullptr || !attribute->getInterval() || attribute->getInterval()->check(value)) {
+      return value;
+    }
+    for (const auto candidate : {1.0, 0.5, 0.0, -1.0, 1000.0}) {
+      if (attribute->getInterval()->check(candidate)) {
+        return candidate;
+      }
+    }
+    return value;
+  }
+
+  inline int64_t TModelGenerator::createInt(const database::TAttribute* attribute, std::mt19937_64& engine)
+  {
+    const auto value = detail::generateInt(engine, 1, 100);
+    if (attribute == nullptr || !attribute->getInterval() ||
+        attribute->getInterval()->check(static_cast<double>(value))) {
+      return value;
+    }
+    for (const auto candidate : {1, 0, -1, 1000}) {
+      if (attribute->getInterval()->check(candidate)) {
+        return candidate;
+      }
+    }
+    return value;
+  }
+
+  inline std::string TModelGenerator::createString(std::mt19937_64& engine)
+  {
+    return fmt::format("value {}", engine() % 10000);
+  }
+
+  inline std::string TModelGenerator::createEnum(const database::TAttribute& attribute, std::mt19937_64& engine)
+  {
+    const auto& values = attribute.getEnums()->getValues();
+    return values[engine() % values.size()].m_Value;
+  }
+}
+
+#endif
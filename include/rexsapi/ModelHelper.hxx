@@ -23,16 +23,35 @@
 #include <rexsapi/database/Component.hxx>
 
 #include <algorithm>
+#include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace rexsapi
 {
+  namespace detail
+  {
+    template<typename NodeType>
+    static inline const NodeType& dereference(const NodeType& node)
+    {
+      return node;
+    }
+
+    template<typename NodeType>
+    static inline const NodeType& dereference(const NodeType* node)
+    {
+      return *node;
+    }
+  }
+
+
   template<typename ValueDecoderType>
   class TModelHelper
   {
   public:
-    explicit TModelHelper(TMode mode)
+    explicit TModelHelper(TMode mode, TDecodeMode decodeMode = TDecodeMode::EAGER)
     : m_Mode{mode}
+    , m_DecodeMode{decodeMode}
     {
     }
 
@@ -57,7 +76,14 @@ namespace rexsapi
     TValue getValue(TResult& result, std::string_view context, std::string_view attributeId, uint64_t componentId,
                     const database::TAttribute& dbAttribute, const NodeType& attribute) const
     {
-      auto value = m_Decoder.decode(dbAttribute.getValueType(), dbAttribute.getEnums(), attribute);
+      return decodeValue(m_Mode, *m_Decoder, result, context, attributeId, componentId, dbAttribute, attribute);
+    }
+
+    template<typename NodeType>
+    TValue getValue(TResult& result, TValueType valueType, std::string_view context, std::string_view attributeId,
+                    uint64_t componentId, const NodeType& attribute) const
+    {
+      auto value = m_Decoder->decode(valueType, {}, attribute);
       if (!value.second) {
         result.addError(
           TError{m_Mode.adapt(TErrorLevel::ERR),
@@ -65,38 +91,84 @@ namespace rexsapi
                              context, attributeId, componentId)});
         return TValue{};
       }
-      if (!TValidityChecker::check(dbAttribute, value.first)) {
-        result.addError(TError{m_Mode.adapt(TErrorLevel::WARN),
-                               fmt::format("{}: value is out of range for attribute id={} of component id={}", context,
-                                           attributeId, componentId)});
+      return value.first;
+    }
+
+    /**
+     * @brief Checks if values of the given type should be decoded on first access.
+     *
+     * Only arrays and matrices are deferred, keeping the source of a scalar value costs more than decoding it.
+     */
+    [[nodiscard]] bool isLazy(TValueType type) const
+    {
+      if (m_DecodeMode != TDecodeMode::LAZY) {
+        return false;
       }
+      switch (type) {
+        case TValueType::FLOATING_POINT_ARRAY:
+        case TValueType::BOOLEAN_ARRAY:
+        case TValueType::INTEGER_ARRAY:
+        case TValueType::STRING_ARRAY:
+        case TValueType::ENUM_ARRAY:
+        case TValueType::FLOATING_POINT_MATRIX:
+        case TValueType::STRING_MATRIX:
+        case TValueType::ARRAY_OF_INTEGER_ARRAYS:
+          return true;
+        default:
+          return false;
+      }
+    }
 
-      return value.first;
+    /**
+     * @brief Creates a value that is decoded on first access.
+     *
+     * The node has to be either a lightweight handle or a pointer into the source document. The source document is
+     * kept alive until the value has been decoded.
+     */
+    template<typename NodeType>
+    std::shared_ptr<const TLazyValue> getLazyValue(std::string_view context, std::string_view attributeId,
+                                                   uint64_t componentId, const database::TAttribute& dbAttribute,
+                                                   NodeType attribute, std::shared_ptr<const void> source) const
+    {
+      return std::make_shared<const TLazyValue>(
+        [mode = m_Mode, decoder = m_Decoder, context = std::string{context}, attributeId = std::string{attributeId},
+         componentId, &dbAttribute, attribute, source = std::move(source)](TResult& result) {
+          return decodeValue(mode, *decoder, result, context, attributeId, componentId, dbAttribute,
+                             detail::dereference(attribute));
+        });
+    }
+
+    const ValueDecoderType& getDecoder() const
+    {
+      return *m_Decoder;
     }
 
+  private:
     template<typename NodeType>
-    TValue getValue(TResult& result, TValueType valueType, std::string_view context, std::string_view attributeId,
-                    uint64_t componentId, const NodeType& attribute) const
+    static TValue decodeValue(const TModeAdapter& mode, const ValueDecoderType& decoder, TResult& result,
+                              std::string_view context, std::string_view attributeId, uint64_t componentId,
+                              const database::TAttribute& dbAttribute, const NodeType& attribute)
     {
-      auto value = m_Decoder.decode(valueType, {}, attribute);
+      auto value = decoder.decode(dbAttribute.getValueType(), dbAttribute.getEnums(), attribute);
       if (!value.second) {
         result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR),
+          TError{mode.adapt(TErrorLevel::ERR),
                  fmt::format("{}: value of attribute id={} of component id={} does not have the correct value type",
                              context, attributeId, componentId)});
         return TValue{};
       }
-      return value.first;
-    }
+      if (!TValidityChecker::check(dbAttribute, value.first)) {
+        result.addError(TError{mode.adapt(TErrorLevel::WARN),
+                               fmt::format("{}: value is out of range for attribute id={} of component id={}", context,
+                                           attributeId, componentId)});
+      }
 
-    const ValueDecoderType& getDecoder() const
-    {
-      return m_Decoder;
+      return value.first;
     }
 
-  private:
     TModeAdapter m_Mode;
-    ValueDecoderType m_Decoder;
+    TDecodeMode m_DecodeMode;
+    std::shared_ptr<const ValueDecoderType> m_Decoder{std::make_shared<const ValueDecoderType>()};
   };
 
 
@@ -111,6 +183,21 @@ namespace rexsapi
       return res;
     }
 
+    /// Maps a component id to an already assigned internal id, e.g. for documents storing internal ids
+    void mapComponent(uint64_t componentId, uint64_t internalId)
+    {
+      m_ComponentsMapping[componentId] = internalId;
+    }
+
+    inline std::optional<uint64_t> getInternalId(uint64_t referenceId) const
+    {
+      const auto it = m_ComponentsMapping.find(referenceId);
+      if (it == m_ComponentsMapping.end()) {
+        return {};
+      }
+      return it->second;
+    }
+
     inline const TComponent* getComponent(uint64_t referenceId, const TComponents& components) const&
     {
       const auto it = m_ComponentsMapping.find(referenceId);
@@ -129,13 +216,20 @@ namespace rexsapi
   };
 
 
+  /**
+   * @brief Replaces the component ids of reference attributes with the internal ids of the referenced components.
+   *
+   * The components are processed in place, only reference attributes are rewritten. References to non existing
+   * components are removed.
+   */
   class ComponentPostProcessor
   {
   public:
-    ComponentPostProcessor(TResult& result, const TModeAdapter& mode, const TComponents& components,
+    ComponentPostProcessor(TResult& result, const TModeAdapter& mode, TComponents components,
                            const ComponentMapping& componentMapping)
+    : m_Components{std::move(components)}
     {
-      process(result, mode, components, componentMapping);
+      process(result, mode, componentMapping);
     }
 
     TComponents&& release()
@@ -144,28 +238,35 @@ namespace rexsapi
     }
 
   private:
-    void process(TResult& result, const TModeAdapter& mode, const TComponents& components,
-                 const ComponentMapping& componentMapping)
-    {
-      for (const auto& component : components) {
-        TAttributes attributes;
-        for (const auto& attribute : component.getAttributes()) {
-          if (attribute.getValueType() == TValueType::REFERENCE_COMPONENT && attribute.hasValue()) {
-            auto id = attribute.getValue<TReferenceComponentType>();
-            const auto* comp = componentMapping.getComponent(static_cast<uint64_t>(id), components);
-            if (!comp) {
+    void process(TResult& result, const TModeAdapter& mode, const ComponentMapping& componentMapping)
+    {
+      std::unordered_set<uint64_t> internalIds;
+      internalIds.reserve(m_Components.size());
+      for (const auto& component : m_Components) {
+        internalIds.emplace(component.getInternalId());
+      }
+
+      for (auto& component : m_Components) {
+        auto& attributes = component.m_Attributes;
+        auto last = attributes.begin();
+        for (auto it = attributes.begin(); it != attributes.end(); ++it) {
+          if (it->getValueType() == TValueType::REFERENCE_COMPONENT && it->hasValue()) {
+            auto id = it->getValue<TReferenceComponentType>();
+            const auto internalId = componentMapping.getInternalId(static_cast<uint64_t>(id));
+            if (!internalId || internalIds.find(*internalId) == internalIds.end()) {
               result.addError(
                 TError{mode.adapt(TErrorLevel::ERR), fmt::format("referenced component id={} does not exist", id)});
               continue;
             }
-            attributes.emplace_back(TAttribute{attribute, TValue{static_cast<int64_t>(comp->getInternalId())}});
-          } else {
-            attributes.emplace_back(attribute);
+            *it = TAttribute{*it, TValue{static_cast<int64_t>(*internalId)}};
+          }
+          if (last != it) {
+            *last = std::move(*it);
           }
+          ++last;
         }
-
-        m_Components.emplace_back(
-          TComponent{component.getInternalId(), component.getType(), component.getName(), std::move(attributes)});
+        attributes.erase(last, attributes.end());
+        component.m_Index = detail::TAttributeIndex{attributes};
       }
     }
 
@@ -17,8 +17,11 @@
 #ifndef REXSAPI_MODEL_LOADER_HXX
 #define REXSAPI_MODEL_LOADER_HXX
 
+#include <rexsapi/BinaryModelLoader.hxx>
 #include <rexsapi/FileUtils.hxx>
 #include <rexsapi/JsonModelLoader.hxx>
+#include <rexsapi/LoadOptions.hxx>
+#include <rexsapi/MappedFile.hxx>
 #include <rexsapi/Model.hxx>
 #include <rexsapi/Result.hxx>
 #include <rexsapi/XMLModelLoader.hxx>
@@ -29,6 +32,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <sstream>
 
 namespace rexsapi
@@ -38,24 +42,25 @@ namespace rexsapi
   public:
     explicit TModelLoader(const std::filesystem::path& databasePath)
     : m_Registry{createModelRegistry(databasePath)}
-    , m_XMLSchemaValidator{createXMLSchemaValidator(databasePath)}
-    , m_JsonValidator{createJsonSchemaValidator(databasePath)}
+    , m_XMLSchemaValidator{xml::TXSDSchemaValidatorCache::get(databasePath / "rexs-schema.xsd")}
+    , m_JsonValidator{TJsonSchemaValidatorCache::get(databasePath / "rexs-schema.json")}
     {
     }
 
-    std::optional<TModel> load(const std::filesystem::path& path, TResult& result,
-                               TMode mode = TMode::STRICT_MODE) const;
+    /**
+     * @brief Loads a model file.
+     *
+     * @param options The decode and validation modes and the optional statistics to collect the load phases in
+     */
+    std::optional<TModel> load(const std::filesystem::path& path, TResult& result, TMode mode = TMode::STRICT_MODE,
+                               const TLoadOptions& options = {}) const;
 
   private:
     static database::TModelRegistry createModelRegistry(const std::filesystem::path& path);
 
-    static xml::TXSDSchemaValidator createXMLSchemaValidator(const std::filesystem::path& path);
-
-    static TJsonSchemaValidator createJsonSchemaValidator(const std::filesystem::path& path);
-
     database::TModelRegistry m_Registry;
-    const xml::TXSDSchemaValidator m_XMLSchemaValidator;
-    const TJsonSchemaValidator m_JsonValidator;
+    std::shared_ptr<const xml::TXSDSchemaValidator> m_XMLSchemaValidator;
+    std::shared_ptr<const TJsonSchemaValidator> m_JsonValidator;
   };
 
 
@@ -70,7 +75,8 @@ namespace rexsapi
     }
 
     [[nodiscard]] std::optional<TModel> load(TMode mode, TResult& result,
-                                             const rexsapi::database::TModelRegistry& registry);
+                                             const rexsapi::database::TModelRegistry& registry,
+                                             const TLoadOptions& options = {});
 
   private:
     const TSchemaValidator& m_Validator;
@@ -95,7 +101,8 @@ namespace rexsapi
     }
 
     [[nodiscard]] std::optional<TModel> load(TMode mode, TResult& result,
-                                             const rexsapi::database::TModelRegistry& registry);
+                                             const rexsapi::database::TModelRegistry& registry,
+                                             const TLoadOptions& options = {});
 
   private:
     const TSchemaValidator& m_Validator;
@@ -107,33 +114,49 @@ namespace rexsapi
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
-  inline std::optional<TModel> TModelLoader::load(const std::filesystem::path& path, TResult& result, TMode mode) const
+  inline std::optional<TModel> TModelLoader::load(const std::filesystem::path& path, TResult& result, TMode mode,
+                                                  const TLoadOptions& options) const
   {
     std::optional<TModel> model;
     result.reset();
 
+    // the peak of the load has to be measured around all phases, as intermediate data outlives single phases
+    std::optional<TAllocationCounter::TScope> allocations;
+    if (options.m_Statistics != nullptr && TAllocationCounter::isEnabled()) {
+      allocations.emplace();
+    }
+
     switch (TExtensionChecker::getFileType(path)) {
       case TFileType::XML: {
-        TFileModelLoader<xml::TXSDSchemaValidator, TXMLModelLoader> loader{m_XMLSchemaValidator, path};
-        model = loader.load(mode, result, m_Registry);
+        TFileModelLoader<xml::TXSDSchemaValidator, TXMLModelLoader> loader{*m_XMLSchemaValidator, path};
+        model = loader.load(mode, result, m_Registry, options);
         break;
       }
       case TFileType::JSON: {
-        TFileModelLoader<TJsonSchemaValidator, TJsonModelLoader> loader{m_JsonValidator, path};
-        model = loader.load(mode, result, m_Registry);
+        TFileModelLoader<TJsonSchemaValidator, TJsonModelLoader> loader{*m_JsonValidator, path};
+        model = loader.load(mode, result, m_Registry, options);
         break;
       }
       case TFileType::COMPRESSED: {
         try {
-          ZipArchive archive{path};
-          auto [buffer, type] = archive.load();
+          std::vector<uint8_t> buffer;
+          TFileType type;
+          {
+            TLoadStatistics::TScope scope{options.m_Statistics, TLoadPhase::INFLATE};
+            ZipArchive archive{path};
+            std::tie(buffer, type) = archive.load();
+            scope.bytes(buffer.size());
+          }
           if (type == TFileType::XML) {
-            TBufferModelLoader<xml::TXSDSchemaValidator, TXMLModelLoader> loader{m_XMLSchemaValidator,
+            TBufferModelLoader<xml::TXSDSchemaValidator, TXMLModelLoader> loader{*m_XMLSchemaValidator,
                                                                                  std::move(buffer)};
-            model = loader.load(mode, result, m_Registry);
+            model = loader.load(mode, result, m_Registry, options);
           } else if (type == TFileType::JSON) {
-            TBufferModelLoader<TJsonSchemaValidator, TJsonModelLoader> loader{m_JsonValidator, std::move(buffer)};
-            model = loader.load(mode, result, m_Registry);
+            TBufferModelLoader<TJsonSchemaValidator, TJsonModelLoader> loader{*m_JsonValidator, std::move(buffer)};
+            model = loader.load(mode, result, m_Registry, options);
+          } else if (type == TFileType::BINARY) {
+            TLoadStatistics::TScope scope{options.m_Statistics, TLoadPhase::VALUE_DECODING, buffer.size()};
+            model = TBinaryModelLoader{mode}.load(result, m_Registry, buffer);
           }
         } catch (const std::exception& ex) {
           result.addError(TError{TErrorLevel::CRIT,
@@ -141,53 +164,67 @@ namespace rexsapi
         }
         break;
       }
+      case TFileType::BINARY: {
+        try {
+          std::optional<TMappedFile> file;
+          {
+            TLoadStatistics::TScope scope{options.m_Statistics, TLoadPhase::FILE_READ};
+            file.emplace(path);
+            scope.bytes(file->size());
+          }
+          TLoadStatistics::TScope scope{options.m_Statistics, TLoadPhase::VALUE_DECODING, file->size()};
+          model = TBinaryModelLoader{mode}.load(result, m_Registry, file->data(), file->size());
+        } catch (const std::exception& ex) {
+          result.addError(TError{TErrorLevel::CRIT, ex.what()});
+        }
+        break;
+      }
       default:
         result.addError(
           TError{TErrorLevel::CRIT, fmt::format("extension {} currently not supported", path.extension().string())});
     }
 
+    if (allocations) {
+      options.m_Statistics->addMemory(allocations->finish());
+    }
+
     return model;
   }
 
   inline database::TModelRegistry TModelLoader::createModelRegistry(const std::filesystem::path& path)
   {
     xml::TFileXsdSchemaLoader schemaLoader{path / "rexs-dbmodel.xsd"};
-    database::TFileResourceLoader resourceLoader{path};
+    database::TFileResourceLoader resourceLoader{path, database::TLoadMode::PARALLEL};
     database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
     return database::TModelRegistry::createModelRegistry(modelLoader).first;
   }
 
-  inline xml::TXSDSchemaValidator TModelLoader::createXMLSchemaValidator(const std::filesystem::path& path)
-  {
-    xml::TFileXsdSchemaLoader schemaLoader{path / "rexs-schema.xsd"};
-    return xml::TXSDSchemaValidator{schemaLoader};
-  }
-
-  inline TJsonSchemaValidator TModelLoader::createJsonSchemaValidator(const std::filesystem::path& path)
-  {
-    TFileJsonSchemaLoader schemaLoader{path / "rexs-schema.json"};
-    return TJsonSchemaValidator{schemaLoader};
-  }
-
   template<typename TSchemaValidator, typename TLoader>
   inline std::optional<TModel>
   TBufferModelLoader<TSchemaValidator, TLoader>::load(TMode mode, TResult& result,
-                                                      const rexsapi::database::TModelRegistry& registry)
+                                                      const rexsapi::database::TModelRegistry& registry,
+                                                      const TLoadOptions& options)
   {
-    TLoader loader{mode, m_Validator};
+    TLoader loader{mode, m_Validator, options};
     return loader.load(result, registry, m_Buffer);
   }
 
   template<typename TSchemaValidator, typename TLoader>
   inline std::optional<TModel>
   TFileModelLoader<TSchemaValidator, TLoader>::load(TMode mode, TResult& result,
-                                                    const rexsapi::database::TModelRegistry& registry)
+                                                    const rexsapi::database::TModelRegistry& registry,
+                                                    const TLoadOptions& options)
   {
-    auto buffer = loadFile(result, m_Path);
+    std::vector<uint8_t> buffer;
+    {
+      TLoadStatistics::TScope scope{options.m_Statistics, TLoadPhase::FILE_READ};
+      buffer = loadFile(result, m_Path);
+      scope.bytes(buffer.size());
+    }
     if (!result) {
       return {};
     }
-    return TLoader{mode, m_Validator}.load(result, registry, buffer);
+    return TLoader{mode, m_Validator, options}.load(result, registry, buffer);
   }
 }
 
@@ -17,6 +17,8 @@
 #ifndef REXSAPI_MODEL_SAVER_HXX
 #define REXSAPI_MODEL_SAVER_HXX
 
+#include <rexsapi/BinaryModelSerializer.hxx>
+#include <rexsapi/BinarySerializer.hxx>
 #include <rexsapi/JsonModelSerializer.hxx>
 #include <rexsapi/JsonSerializer.hxx>
 #include <rexsapi/Result.hxx>
@@ -25,12 +27,17 @@
 
 namespace rexsapi
 {
-  enum class TSaveType { JSON, XML };
+  enum class TSaveType { JSON, XML, COMPRESSED_XML, COMPRESSED_JSON, BINARY };
 
 
   class TModelSaver
   {
   public:
+    explicit TModelSaver(int compressionLevel = MZ_DEFAULT_LEVEL)
+    : m_CompressionLevel{compressionLevel}
+    {
+    }
+
     void store(TResult& result, const TModel& model, const std::filesystem::path& path, TSaveType type)
     {
       try {
@@ -47,9 +54,27 @@ namespace rexsapi
             modelSerializer.serialize(model, xmlSerializer);
             break;
           }
+          case TSaveType::COMPRESSED_XML: {
+            rexsapi::XMLZipFileSerializer zipSerializer{addExtension(path, ".rexsz"), m_CompressionLevel};
+            rexsapi::XMLModelSerializer modelSerializer;
+            modelSerializer.serialize(model, zipSerializer);
+            break;
+          }
+          case TSaveType::COMPRESSED_JSON: {
+            rexsapi::JsonZipFileSerializer zipSerializer{addExtension(path, ".rexsz"), m_CompressionLevel};
+            rexsapi::JsonModelSerializer modelSerializer;
+            modelSerializer.serialize(model, zipSerializer);
+            break;
+          }
+          case TSaveType::BINARY: {
+            rexsapi::BinaryFileSerializer binarySerializer{addExtension(path, ".rexsb")};
+            rexsapi::BinaryModelSerializer modelSerializer;
+            modelSerializer.serialize(model, binarySerializer);
+            break;
+          }
         }
       } catch (const std::exception& ex) {
-        result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot store model to {}: {}", ex.what())});
+        result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot store model to {}: {}", path.string(), ex.what())});
       }
     }
 
@@ -58,6 +83,8 @@ namespace rexsapi
     {
       return path.has_extension() ? path : path.concat(extension);
     }
+
+    int m_CompressionLevel;
   };
 }
 
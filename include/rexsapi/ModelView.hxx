@@ -0,0 +1,585 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_MODEL_VIEW_HXX
+#define REXSAPI_MODEL_VIEW_HXX
+
+#include <rexsapi/BinaryFormat.hxx>
+#include <rexsapi/MappedFile.hxx>
+#include <rexsapi/Model.hxx>
+
+#include <memory>
+
+namespace rexsapi
+{
+  /**
+   * @brief Read-only, span-like view of contiguous values.
+   *
+   * A view does not own its values. Views handed out by a TModelView point directly into the mapped file and stay
+   * valid as long as the model view exists.
+   */
+  template<typename T>
+  class TArrayView
+  {
+  public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    TArrayView() = default;
+
+    TArrayView(const T* data, size_t size) noexcept
+    : m_Data{data}
+    , m_Size{size}
+    {
+    }
+
+    [[nodiscard]] const T* data() const noexcept
+    {
+      return m_Data;
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return m_Size == 0;
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+      return m_Data[index];
+    }
+
+    [[nodiscard]] const T& at(size_t index) const
+    {
+      if (index >= m_Size) {
+        throw TException{fmt::format("index {} is out of range", index)};
+      }
+      return m_Data[index];
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return m_Data;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return m_Data + m_Size;
+    }
+
+  private:
+    const T* m_Data{nullptr};
+    size_t m_Size{0};
+  };
+
+
+  /**
+   * @brief Read-only view of a row-major matrix.
+   */
+  template<typename T>
+  class TMatrixView
+  {
+  public:
+    TMatrixView() = default;
+
+    TMatrixView(const T* data, size_t rows, size_t columns) noexcept
+    : m_Data{data}
+    , m_Rows{rows}
+    , m_Columns{columns}
+    {
+    }
+
+    [[nodiscard]] size_t getRows() const noexcept
+    {
+      return m_Rows;
+    }
+
+    [[nodiscard]] size_t getColumns() const noexcept
+    {
+      return m_Columns;
+    }
+
+    const T& operator()(size_t row, size_t column) const noexcept
+    {
+      return m_Data[row * m_Columns + column];
+    }
+
+    [[nodiscard]] TArrayView<T> getRow(size_t row) const
+    {
+      if (row >= m_Rows) {
+        throw TException{fmt::format("row {} is out of range", row)};
+      }
+      return TArrayView<T>{m_Data + row * m_Columns, m_Columns};
+    }
+
+    [[nodiscard]] TArrayView<T> getValues() const noexcept
+    {
+      return TArrayView<T>{m_Data, m_Rows * m_Columns};
+    }
+
+  private:
+    const T* m_Data{nullptr};
+    size_t m_Rows{0};
+    size_t m_Columns{0};
+  };
+
+
+  class TAttributeView
+  {
+  public:
+    TAttributeView(const binary::TBinaryDocument& doc, binary::TBinaryAttributeRecord record) noexcept
+    : m_Doc{&doc}
+    , m_Record{record}
+    {
+    }
+
+    [[nodiscard]] std::string_view getAttributeId() const
+    {
+      return m_Doc->getString(m_Record.m_Id);
+    }
+
+    [[nodiscard]] std::string_view getUnit() const
+    {
+      return m_Doc->getString(m_Record.m_Unit);
+    }
+
+    [[nodiscard]] TValueType getValueType() const noexcept
+    {
+      return m_Record.m_Type;
+    }
+
+    [[nodiscard]] bool isCustomAttribute() const noexcept
+    {
+      return m_Record.isCustom();
+    }
+
+    [[nodiscard]] bool hasValue() const noexcept
+    {
+      return m_Record.hasValue();
+    }
+
+    [[nodiscard]] TCodeType getCodeType() const noexcept
+    {
+      return m_Record.m_CodeType;
+    }
+
+    /**
+     * @brief Decodes the value into a newly allocated TValue.
+     */
+    [[nodiscard]] TValue getValue() const
+    {
+      return m_Doc->getValue(m_Record);
+    }
+
+    /**
+     * @brief Returns the string of a string, enum or file reference attribute without copying it.
+     */
+    [[nodiscard]] std::string_view getString() const;
+
+    /**
+     * @brief Returns an in place view of an array attribute.
+     *
+     * Supported element types are double for floating point arrays, int64_t for integer arrays and uint8_t for boolean
+     * arrays.
+     */
+    template<typename T>
+    [[nodiscard]] TArrayView<T> getArray() const;
+
+    [[nodiscard]] TMatrixView<double> getMatrix() const;
+
+    [[nodiscard]] std::vector<TArrayView<int64_t>> getArrays() const;
+
+  private:
+    void checkType(TValueType type) const;
+
+    const binary::TBinaryDocument* m_Doc;
+    binary::TBinaryAttributeRecord m_Record;
+  };
+
+
+  class TAttributesView
+  {
+  public:
+    TAttributesView(const binary::TBinaryDocument& doc, uint64_t table)
+    : m_Doc{&doc}
+    , m_Table{table}
+    , m_Size{doc.getTableSize(table)}
+    {
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return m_Size == 0;
+    }
+
+    TAttributeView operator[](size_t index) const
+    {
+      return TAttributeView{*m_Doc, m_Doc->getAttribute(m_Table, index)};
+    }
+
+    [[nodiscard]] std::optional<TAttributeView> find(std::string_view attributeId) const;
+
+  private:
+    const binary::TBinaryDocument* m_Doc;
+    uint64_t m_Table;
+    size_t m_Size;
+  };
+
+
+  class TComponentView
+  {
+  public:
+    TComponentView(const binary::TBinaryDocument& doc, uint64_t index)
+    : m_Doc{&doc}
+    , m_Index{index}
+    , m_Record{doc.getComponent(index)}
+    {
+    }
+
+    [[nodiscard]] uint64_t getIndex() const noexcept
+    {
+      return m_Index;
+    }
+
+    [[nodiscard]] uint64_t getInternalId() const noexcept
+    {
+      return m_Record.m_InternalId;
+    }
+
+    [[nodiscard]] std::string_view getType() const
+    {
+      return m_Doc->getString(m_Record.m_Type);
+    }
+
+    [[nodiscard]] std::string_view getName() const
+    {
+      return m_Doc->getString(m_Record.m_Name);
+    }
+
+    [[nodiscard]] TAttributesView getAttributes() const
+    {
+      return TAttributesView{*m_Doc, m_Record.m_AttributeTable};
+    }
+
+  private:
+    const binary::TBinaryDocument* m_Doc;
+    uint64_t m_Index;
+    binary::TBinaryComponentRecord m_Record;
+  };
+
+
+  class TRelationReferenceView
+  {
+  public:
+    TRelationReferenceView(const binary::TBinaryDocument& doc, binary::TBinaryReferenceRecord record) noexcept
+    : m_Doc{&doc}
+    , m_Record{record}
+    {
+    }
+
+    [[nodiscard]] TRelationRole getRole() const noexcept
+    {
+      return m_Record.m_Role;
+    }
+
+    [[nodiscard]] std::string_view getHint() const
+    {
+      return m_Doc->getString(m_Record.m_Hint);
+    }
+
+    [[nodiscard]] uint64_t getComponentIndex() const noexcept
+    {
+      return m_Record.m_Component;
+    }
+
+  private:
+    const binary::TBinaryDocument* m_Doc;
+    binary::TBinaryReferenceRecord m_Record;
+  };
+
+
+  class TRelationView
+  {
+  public:
+    TRelationView(const binary::TBinaryDocument& doc, uint64_t index)
+    : m_Doc{&doc}
+    , m_Record{doc.getRelation(index)}
+    {
+    }
+
+    [[nodiscard]] TRelationType getType() const noexcept
+    {
+      return m_Record.m_Type;
+    }
+
+    [[nodiscard]] std::optional<uint32_t> getOrder() const noexcept
+    {
+      return m_Record.m_Order;
+    }
+
+    [[nodiscard]] size_t getReferenceCount() const noexcept
+    {
+      return m_Record.m_ReferenceCount;
+    }
+
+    [[nodiscard]] TRelationReferenceView getReference(size_t index) const
+    {
+      return TRelationReferenceView{*m_Doc, m_Doc->getReference(m_Record, index)};
+    }
+
+  private:
+    const binary::TBinaryDocument* m_Doc;
+    binary::TBinaryRelationRecord m_Record;
+  };
+
+
+  class TLoadComponentView
+  {
+  public:
+    TLoadComponentView(const binary::TBinaryDocument& doc, binary::TBinaryLoadComponentRecord record) noexcept
+    : m_Doc{&doc}
+    , m_Record{record}
+    {
+    }
+
+    [[nodiscard]] uint64_t getComponentIndex() const noexcept
+    {
+      return m_Record.m_Component;
+    }
+
+    [[nodiscard]] TAttributesView getLoadAttributes() const
+    {
+      return TAttributesView{*m_Doc, m_Record.m_AttributeTable};
+    }
+
+  private:
+    const binary::TBinaryDocument* m_Doc;
+    binary::TBinaryLoadComponentRecord m_Record;
+  };
+
+
+  class TLoadCaseView
+  {
+  public:
+    TLoadCaseView(const binary::TBinaryDocument& doc, uint64_t table)
+    : m_Doc{&doc}
+    , m_Table{table}
+    , m_Size{doc.getLoadComponentCount(table)}
+    {
+    }
+
+    [[nodiscard]] size_t getLoadComponentCount() const noexcept
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] TLoadComponentView getLoadComponent(size_t index) const
+    {
+      return TLoadComponentView{*m_Doc, m_Doc->getLoadComponent(m_Table, index)};
+    }
+
+  private:
+    const binary::TBinaryDocument* m_Doc;
+    uint64_t m_Table;
+    size_t m_Size;
+  };
+
+
+  /**
+   * @brief Read-only view of a binary REXS model file.
+   *
+   * The file is memory mapped and only the header is checked on opening, so opening a model takes constant time
+   * regardless of its size. Components, relations and load cases are decoded on access, array and matrix values can be
+   * accessed in place without copying. All views handed out stay valid as long as the model view exists.
+   *
+   * Contrary to the TModelLoader, the model is not checked against the database model.
+   */
+  class TModelView
+  {
+  public:
+    explicit TModelView(const std::filesystem::path& path);
+
+    [[nodiscard]] const TModelInfo& getInfo() const noexcept
+    {
+      return m_Info;
+    }
+
+    [[nodiscard]] size_t getComponentCount() const
+    {
+      return m_Doc->getComponentCount();
+    }
+
+    [[nodiscard]] TComponentView getComponent(size_t index) const
+    {
+      return TComponentView{*m_Doc, index};
+    }
+
+    [[nodiscard]] size_t getRelationCount() const
+    {
+      return m_Doc->getRelationCount();
+    }
+
+    [[nodiscard]] TRelationView getRelation(size_t index) const
+    {
+      return TRelationView{*m_Doc, index};
+    }
+
+    [[nodiscard]] size_t getLoadCaseCount() const
+    {
+      return m_Doc->getLoadCaseCount();
+    }
+
+    [[nodiscard]] TLoadCaseView getLoadCase(size_t index) const
+    {
+      return TLoadCaseView{*m_Doc, m_Doc->getLoadCase(index)};
+    }
+
+    [[nodiscard]] bool hasAccumulation() const
+    {
+      return m_Doc->getAccumulation().has_value();
+    }
+
+    [[nodiscard]] TLoadCaseView getAccumulation() const;
+
+  private:
+    std::unique_ptr<TMappedFile> m_File;
+    std::unique_ptr<binary::TBinaryDocument> m_Doc;
+    TModelInfo m_Info;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  namespace detail
+  {
+    template<typename T>
+    struct TArrayViewType;
+
+    template<>
+    struct TArrayViewType<double> {
+      static constexpr TValueType Type = TValueType::FLOATING_POINT_ARRAY;
+    };
+
+    template<>
+    struct TArrayViewType<int64_t> {
+      static constexpr TValueType Type = TValueType::INTEGER_ARRAY;
+    };
+
+    template<>
+    struct TArrayViewType<uint8_t> {
+      static constexpr TValueType Type = TValueType::BOOLEAN_ARRAY;
+    };
+  }
+
+  inline void TAttributeView::checkType(TValueType type) const
+  {
+    if (m_Record.m_Type != type) {
+      throw TException{fmt::format("attribute id={} is of type {}, not {}", getAttributeId(),
+                                   toTypeString(m_Record.m_Type), toTypeString(type))};
+    }
+    if (!hasValue()) {
+      throw TException{fmt::format("attribute id={} has no value", getAttributeId())};
+    }
+  }
+
+  inline std::string_view TAttributeView::getString() const
+  {
+    if (m_Record.m_Type != TValueType::ENUM && m_Record.m_Type != TValueType::FILE_REFERENCE) {
+      checkType(TValueType::STRING);
+    }
+    if (!hasValue()) {
+      throw TException{fmt::format("attribute id={} has no value", getAttributeId())};
+    }
+    return m_Doc->getString(m_Doc->read<uint32_t>(m_Record.m_Payload));
+  }
+
+  template<typename T>
+  inline TArrayView<T> TAttributeView::getArray() const
+  {
+    checkType(detail::TArrayViewType<T>::Type);
+    const auto count = m_Doc->read<uint64_t>(m_Record.m_Payload);
+    return TArrayView<T>{m_Doc->view<T>(m_Record.m_Payload + 8, count), count};
+  }
+
+  inline TMatrixView<double> TAttributeView::getMatrix() const
+  {
+    checkType(TValueType::FLOATING_POINT_MATRIX);
+    const auto rows = m_Doc->read<uint64_t>(m_Record.m_Payload);
+    const auto columns = m_Doc->read<uint64_t>(m_Record.m_Payload + 8);
+    if (rows > m_Doc->size() || (columns && rows > m_Doc->size() / columns)) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", m_Record.m_Payload)};
+    }
+    return TMatrixView<double>{m_Doc->view<double>(m_Record.m_Payload + 16, rows * columns), rows, columns};
+  }
+
+  inline std::vector<TArrayView<int64_t>> TAttributeView::getArrays() const
+  {
+    checkType(TValueType::ARRAY_OF_INTEGER_ARRAYS);
+    const auto count = m_Doc->read<uint64_t>(m_Record.m_Payload);
+    if (count > m_Doc->size() / 8) {
+      throw TException{fmt::format("binary rexs document is corrupt at offset {}", m_Record.m_Payload)};
+    }
+    std::vector<TArrayView<int64_t>> arrays;
+    arrays.reserve(count);
+    auto offset = m_Record.m_Payload + 8;
+    for (uint64_t n = 0; n < count; ++n) {
+      const auto size = m_Doc->read<uint64_t>(offset);
+      arrays.emplace_back(m_Doc->view<int64_t>(offset + 8, size), size);
+      offset += 8 + 8 * size;
+    }
+    return arrays;
+  }
+
+  inline std::optional<TAttributeView> TAttributesView::find(std::string_view attributeId) const
+  {
+    for (size_t n = 0; n < m_Size; ++n) {
+      auto attribute = (*this)[n];
+      if (attribute.getAttributeId() == attributeId) {
+        return attribute;
+      }
+    }
+    return {};
+  }
+
+  inline TModelView::TModelView(const std::filesystem::path& path)
+  : m_File{std::make_unique<TMappedFile>(path)}
+  , m_Doc{std::make_unique<binary::TBinaryDocument>(m_File->data(), m_File->size())}
+  , m_Info{m_Doc->getInfo()}
+  {
+  }
+
+  inline TLoadCaseView TModelView::getAccumulation() const
+  {
+    const auto offset = m_Doc->getAccumulation();
+    if (!offset.has_value()) {
+      throw TException{"model has no accumulation"};
+    }
+    return TLoadCaseView{*m_Doc, *offset};
+  }
+}
+
+#endif
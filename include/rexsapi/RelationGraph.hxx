@@ -0,0 +1,295 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_RELATION_GRAPH_HXX
+#define REXSAPI_RELATION_GRAPH_HXX
+
+#include <rexsapi/Model.hxx>
+
+#include <algorithm>
+#include <functional>
+
+namespace rexsapi
+{
+  using TComponentRefs = std::vector<std::reference_wrapper<const TComponent>>;
+
+
+  /**
+   * @brief A relation a component is referenced in, together with the reference of the component.
+   */
+  struct TRelationIncidence {
+    const TRelation* m_Relation;
+    const TRelationReference* m_Reference;
+  };
+
+
+  /**
+   * @brief Read-only range of the relations of a component.
+   */
+  class TRelationIncidences
+  {
+  public:
+    using const_iterator = const TRelationIncidence*;
+
+    TRelationIncidences(const TRelationIncidence* begin, const TRelationIncidence* end) noexcept
+    : m_Begin{begin}
+    , m_End{end}
+    {
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return static_cast<size_t>(m_End - m_Begin);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return m_Begin == m_End;
+    }
+
+    const TRelationIncidence& operator[](size_t index) const noexcept
+    {
+      return m_Begin[index];
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return m_Begin;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return m_End;
+    }
+
+  private:
+    const TRelationIncidence* m_Begin;
+    const TRelationIncidence* m_End;
+  };
+
+
+  /**
+   * @brief Adjacency structure of the relations of a model.
+   *
+   * The relations of every component are stored in one array in compressed sparse row layout, so the relations of a
+   * component are found in constant time. The graph is built in linear time in the number of relation references and
+   * references the components and relations of the model, so the model has to outlive the graph.
+   */
+  class TRelationGraph
+  {
+  public:
+    explicit TRelationGraph(const TModel& model);
+
+    /// Returns the relations the component is referenced in, in model order
+    [[nodiscard]] TRelationIncidences getRelations(const TComponent& component) const;
+
+    /// Returns all components sharing a relation with the component in model order
+    [[nodiscard]] TComponentRefs getNeighbors(const TComponent& component) const;
+
+    /// Returns the components referenced with the role in relations of the component in model order
+    [[nodiscard]] TComponentRefs getNeighbors(const TComponent& component, TRelationRole role) const;
+
+    /// Returns the components sharing a relation of the type with the component in model order
+    [[nodiscard]] TComponentRefs getNeighbors(const TComponent& component, TRelationType type) const;
+
+    /**
+     * @brief Returns the components connected to the component by relations, including the component.
+     *
+     * @param follow Decides which relations connect components, all relations if empty
+     */
+    [[nodiscard]] TComponentRefs getSubassembly(const TComponent& component,
+                                                const std::function<bool(const TRelation&)>& follow = {}) const;
+
+    /**
+     * @brief Returns all groups of connected components.
+     *
+     * Every component is in exactly one group, components without relations form a group of their own. Groups are
+     * ordered by their first component, components in model order.
+     *
+     * @param follow Decides which relations connect components, all relations if empty
+     */
+    [[nodiscard]] std::vector<TComponentRefs>
+    getSubassemblies(const std::function<bool(const TRelation&)>& follow = {}) const;
+
+  private:
+    size_t getIndex(const TComponent& component) const;
+
+    template<typename Filter>
+    TComponentRefs collectNeighbors(const TComponent& component, Filter&& filter) const;
+
+    void visit(size_t start, const std::function<bool(const TRelation&)>& follow, std::vector<bool>& visited,
+               std::vector<size_t>& group) const;
+
+    const TComponents& m_Components;
+    std::vector<size_t> m_Offsets;
+    std::vector<TRelationIncidence> m_Incidences;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TRelationGraph::TRelationGraph(const TModel& model)
+  : m_Components{model.getComponents()}
+  , m_Offsets(m_Components.size() + 1, 0)
+  {
+    for (const auto& relation : model.getRelations()) {
+      for (const auto& reference : relation.getReferences()) {
+        ++m_Offsets[getIndex(reference.getComponent()) + 1];
+      }
+    }
+    for (size_t n = 1; n < m_Offsets.size(); ++n) {
+      m_Offsets[n] += m_Offsets[n - 1];
+    }
+
+    m_Incidences.resize(m_Offsets.back());
+    std::vector<size_t> positions(m_Offsets.begin(), m_Offsets.end() - 1);
+    for (const auto& relation : model.getRelations()) {
+      for (const auto& reference : relation.getReferences()) {
+        m_Incidences[positions[getIndex(reference.getComponent())]++] = TRelationIncidence{&relation, &reference};
+      }
+    }
+  }
+
+  inline TRelationIncidences TRelationGraph::getRelations(const TComponent& component) const
+  {
+    const auto index = getIndex(component);
+    return TRelationIncidences{m_Incidences.data() + m_Offsets[index], m_Incidences.data() + m_Offsets[index + 1]};
+  }
+
+  inline TComponentRefs TRelationGraph::getNeighbors(const TComponent& component) const
+  {
+    return collectNeighbors(component, [](const TRelation&, const TRelationReference&) {
+      return true;
+    });
+  }
+
+  inline TComponentRefs TRelationGraph::getNeighbors(const TComponent& component, TRelationRole role) const
+  {
+    return collectNeighbors(component, [role](const TRelation&, const TRelationReference& reference) {
+      return reference.getRole() == role;
+    });
+  }
+
+  inline TComponentRefs TRelationGraph::getNeighbors(const TComponent& component, TRelationType type) const
+  {
+    return collectNeighbors(component, [type](const TRelation& relation, const TRelationReference&) {
+      return relation.getType() == type;
+    });
+  }
+
+  inline TComponentRefs TRelationGraph::getSubassembly(const TComponent& component,
+                                                       const std::function<bool(const TRelation&)>& follow) const
+  {
+    std::vector<bool> visited(m_Components.size(), false);
+    std::vector<size_t> group;
+    visit(getIndex(component), follow, visited, group);
+    std::sort(group.begin(), group.end());
+
+    TComponentRefs components;
+    components.reserve(group.size());
+    for (const auto index : group) {
+      components.emplace_back(m_Components[index]);
+    }
+    return components;
+  }
+
+  inline std::vector<TComponentRefs>
+  TRelationGraph::getSubassemblies(const std::function<bool(const TRelation&)>& follow) const
+  {
+    std::vector<TComponentRefs> subassemblies;
+    std::vector<bool> visited(m_Components.size(), false);
+    std::vector<size_t> group;
+    for (size_t n = 0; n < m_Components.size(); ++n) {
+      if (visited[n]) {
+        continue;
+      }
+      group.clear();
+      visit(n, follow, visited, group);
+      std::sort(group.begin(), group.end());
+
+      auto& components = subassemblies.emplace_back();
+      components.reserve(group.size());
+      for (const auto index : group) {
+        components.emplace_back(m_Components[index]);
+      }
+    }
+    return subassemblies;
+  }
+
+  inline size_t TRelationGraph::getIndex(const TComponent& component) const
+  {
+    // components are stored contiguously, so the index of a component is its offset in the model
+    const auto* begin = m_Components.data();
+    const std::less<const TComponent*> less;
+    if (less(&component, begin) || !less(&component, begin + m_Components.size())) {
+      throw TException{fmt::format("component id={} is not part of the model", component.getInternalId())};
+    }
+    return static_cast<size_t>(&component - begin);
+  }
+
+  template<typename Filter>
+  inline TComponentRefs TRelationGraph::collectNeighbors(const TComponent& component, Filter&& filter) const
+  {
+    const auto index = getIndex(component);
+    std::vector<size_t> neighbors;
+    for (const auto& incidence : getRelations(component)) {
+      for (const auto& reference : incidence.m_Relation->getReferences()) {
+        const auto neighbor = getIndex(reference.getComponent());
+        if (neighbor != index && filter(*incidence.m_Relation, reference)) {
+          neighbors.emplace_back(neighbor);
+        }
+      }
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+    TComponentRefs components;
+    components.reserve(neighbors.size());
+    for (const auto neighbor : neighbors) {
+      components.emplace_back(m_Components[neighbor]);
+    }
+    return components;
+  }
+
+  inline void TRelationGraph::visit(size_t start, const std::function<bool(const TRelation&)>& follow,
+                                    std::vector<bool>& visited, std::vector<size_t>& group) const
+  {
+    std::vector<size_t> stack{start};
+    visited[start] = true;
+    while (!stack.empty()) {
+      const auto index = stack.back();
+      stack.pop_back();
+      group.emplace_back(index);
+      for (size_t n = m_Offsets[index]; n < m_Offsets[index + 1]; ++n) {
+        const auto& relation = *m_Incidences[n].m_Relation;
+        if (follow && !follow(relation)) {
+          continue;
+        }
+        for (const auto& reference : relation.getReferences()) {
+          const auto neighbor = getIndex(reference.getComponent());
+          if (!visited[neighbor]) {
+            visited[neighbor] = true;
+            stack.emplace_back(neighbor);
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
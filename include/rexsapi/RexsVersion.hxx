@@ -20,67 +20,71 @@
 #include <rexsapi/Exception.hxx>
 #include <rexsapi/Format.hxx>
 
-#include <regex>
+#include <limits>
+#include <string_view>
 
 namespace rexsapi
 {
   class TRexsVersion
   {
   public:
-    explicit TRexsVersion(const std::string& version)
+    /**
+     * @brief Parses a version of the form major.minor
+     *
+     * Major and minor have to consist of decimal digits only and have to fit into 32 bit.
+     *
+     * @throws TException if the version does not match the format
+     */
+    explicit constexpr TRexsVersion(std::string_view version)
+    : m_Major{parseNumber(version, version.substr(0, version.find('.')))}
+    , m_Minor{parseNumber(version, version.find('.') == std::string_view::npos
+                                     ? std::string_view{}
+                                     : version.substr(version.find('.') + 1))}
     {
-      static std::regex regExpr{R"(^(\d+)\.(\d+)$)"};
-      std::smatch match;
-      if (std::regex_search(version, match, regExpr)) {
-        m_Major = static_cast<uint32_t>(std::stoul(match[1]));
-        m_Minor = static_cast<uint32_t>(std::stoul(match[2]));
-      } else {
-        throw TException{fmt::format("not a valid version: '{}'", version)};
-      }
     }
 
-    TRexsVersion(uint32_t major, uint32_t minor)
+    constexpr TRexsVersion(uint32_t major, uint32_t minor)
     : m_Major{major}
     , m_Minor{minor}
     {
     }
 
-    friend bool operator==(const TRexsVersion& lhs, const TRexsVersion& rhs)
+    friend constexpr bool operator==(const TRexsVersion& lhs, const TRexsVersion& rhs)
     {
       return lhs.getMajor() == rhs.getMajor() && lhs.getMinor() == rhs.getMinor();
     }
 
-    friend bool operator!=(const TRexsVersion& lhs, const TRexsVersion& rhs)
+    friend constexpr bool operator!=(const TRexsVersion& lhs, const TRexsVersion& rhs)
     {
       return !(rhs == lhs);
     }
 
-    friend bool operator<(const TRexsVersion& lhs, const TRexsVersion& rhs)
+    friend constexpr bool operator<(const TRexsVersion& lhs, const TRexsVersion& rhs)
     {
       return lhs.getMajor() < rhs.getMajor() || (lhs.getMajor() == rhs.getMajor() && lhs.getMinor() < rhs.getMinor());
     }
 
-    friend bool operator>(const TRexsVersion& lhs, const TRexsVersion& rhs)
+    friend constexpr bool operator>(const TRexsVersion& lhs, const TRexsVersion& rhs)
     {
       return lhs.getMajor() > rhs.getMajor() || (lhs.getMajor() == rhs.getMajor() && lhs.getMinor() > rhs.getMinor());
     }
 
-    friend bool operator<=(const TRexsVersion& lhs, const TRexsVersion& rhs)
+    friend constexpr bool operator<=(const TRexsVersion& lhs, const TRexsVersion& rhs)
     {
       return lhs < rhs || lhs == rhs;
     }
 
-    friend bool operator>=(const TRexsVersion& lhs, const TRexsVersion& rhs)
+    friend constexpr bool operator>=(const TRexsVersion& lhs, const TRexsVersion& rhs)
     {
       return lhs > rhs || lhs == rhs;
     }
 
-    uint32_t getMajor() const
+    constexpr uint32_t getMajor() const
     {
       return m_Major;
     }
 
-    uint32_t getMinor() const
+    constexpr uint32_t getMinor() const
     {
       return m_Minor;
     }
@@ -91,6 +95,24 @@ namespace rexsapi
     }
 
   private:
+    static constexpr uint32_t parseNumber(std::string_view version, std::string_view number)
+    {
+      if (number.empty()) {
+        throw TException{fmt::format("not a valid version: '{}'", version)};
+      }
+      uint64_t value = 0;
+      for (const char c : number) {
+        if (c < '0' || c > '9') {
+          throw TException{fmt::format("not a valid version: '{}'", version)};
+        }
+        value = value * 10 + static_cast<uint64_t>(c - '0');
+        if (value > std::numeric_limits<uint32_t>::max()) {
+          throw TException{fmt::format("not a valid version: '{}'", version)};
+        }
+      }
+      return static_cast<uint32_t>(value);
+    }
+
     uint32_t m_Major;
     uint32_t m_Minor;
   };
@@ -17,6 +17,8 @@
 #ifndef REXSAPI_HXX
 #define REXSAPI_HXX
 
+#include <rexsapi/BinaryModelSerializer.hxx>
+#include <rexsapi/BinarySerializer.hxx>
 #include <rexsapi/Defines.hxx>
 #include <rexsapi/JsonModelSerializer.hxx>
 #include <rexsapi/JsonSerializer.hxx>
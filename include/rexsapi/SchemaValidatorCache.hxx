@@ -0,0 +1,116 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_SCHEMA_VALIDATOR_CACHE_HXX
+#define REXSAPI_SCHEMA_VALIDATOR_CACHE_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/FileUtils.hxx>
+#include <rexsapi/Format.hxx>
+#include <rexsapi/Hash.hxx>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rexsapi
+{
+  /**
+   * @brief Process wide cache of compiled schema validators.
+   *
+   * Validators are cached by schema file path and checked against a hash of the file content, so a changed schema file
+   * is compiled again. Each schema is compiled once even if requested concurrently.
+   *
+   * @tparam TValidator The validator to compile the schema into
+   * @tparam TBufferLoader The schema loader used to pass the file content to the validator
+   */
+  template<typename TValidator, typename TBufferLoader>
+  class TSchemaValidatorCache
+  {
+  public:
+    static std::shared_ptr<const TValidator> get(const std::filesystem::path& schema);
+
+    static void clear();
+
+  private:
+    struct TEntry {
+      uint64_t m_Hash;
+      std::shared_ptr<const TValidator> m_Validator;
+    };
+
+    static uint64_t hash(const std::vector<uint8_t>& buffer) noexcept;
+
+    static std::mutex& mutex()
+    {
+      static std::mutex mutex;
+      return mutex;
+    }
+
+    static std::unordered_map<std::string, TEntry>& entries()
+    {
+      static std::unordered_map<std::string, TEntry> entries;
+      return entries;
+    }
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  template<typename TValidator, typename TBufferLoader>
+  inline std::shared_ptr<const TValidator>
+  TSchemaValidatorCache<TValidator, TBufferLoader>::get(const std::filesystem::path& schema)
+  {
+    TResult result;
+    const auto buffer = loadFile(result, schema);
+    if (!result) {
+      throw TException{fmt::format("Cannot load schema '{}': {}", schema.string(), result.getErrors()[0].getMessage())};
+    }
+    const auto contentHash = hash(buffer);
+    const auto key = std::filesystem::weakly_canonical(schema).string();
+
+    std::scoped_lock lock{mutex()};
+    auto& cached = entries();
+    if (const auto it = cached.find(key); it != cached.end() && it->second.m_Hash == contentHash) {
+      return it->second.m_Validator;
+    }
+
+    const TBufferLoader loader{std::string{buffer.begin(), buffer.end()}};
+    auto validator = std::make_shared<const TValidator>(loader);
+    cached.insert_or_assign(key, TEntry{contentHash, validator});
+    return validator;
+  }
+
+  template<typename TValidator, typename TBufferLoader>
+  inline void TSchemaValidatorCache<TValidator, TBufferLoader>::clear()
+  {
+    std::scoped_lock lock{mutex()};
+    entries().clear();
+  }
+
+  template<typename TValidator, typename TBufferLoader>
+  inline uint64_t TSchemaValidatorCache<TValidator, TBufferLoader>::hash(const std::vector<uint8_t>& buffer) noexcept
+  {
+    return detail::fnv1a(detail::Fnv1aOffsetBasis, buffer.data(), buffer.size());
+  }
+}
+
+#endif
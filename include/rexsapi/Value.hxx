@@ -36,12 +36,12 @@ namespace rexsapi
 
     template<typename T>
     explicit TValue(T&& val)
-    : m_Value(std::forward<T>(val))
+    : m_Value(detail::to_storage(std::forward<T>(val)))
     {
     }
 
     explicit TValue(const char* val)
-    : m_Value(std::string(val))
+    : m_Value(detail::to_storage(std::string(val)))
     {
     }
 
@@ -58,7 +58,7 @@ namespace rexsapi
     template<typename T>
     TValue& operator=(T&& val)
     {
-      m_Value = std::forward<T>(val);
+      m_Value = detail::to_storage(std::forward<T>(val));
       return *this;
     }
 
@@ -70,7 +70,7 @@ namespace rexsapi
 
     TValue& operator=(const char* val)
     {
-      m_Value = std::string(val);
+      m_Value = detail::to_storage(std::string(val));
       return *this;
     }
 
@@ -116,35 +116,35 @@ namespace rexsapi
     {
       switch (type) {
         case TValueType::FLOATING_POINT:
-          return std::holds_alternative<TFloatType>(m_Value);
+          return detail::holds<TFloatType>(m_Value);
         case TValueType::INTEGER:
-          return std::holds_alternative<TIntType>(m_Value);
+          return detail::holds<TIntType>(m_Value);
         case TValueType::BOOLEAN:
-          return std::holds_alternative<TBoolType>(m_Value);
+          return detail::holds<TBoolType>(m_Value);
         case TValueType::ENUM:
-          return std::holds_alternative<TEnumType>(m_Value);
+          return detail::holds<TEnumType>(m_Value);
         case TValueType::STRING:
-          return std::holds_alternative<TStringType>(m_Value);
+          return detail::holds<TStringType>(m_Value);
         case TValueType::FILE_REFERENCE:
-          return std::holds_alternative<TFileReferenceType>(m_Value);
+          return detail::holds<TFileReferenceType>(m_Value);
         case TValueType::FLOATING_POINT_ARRAY:
-          return std::holds_alternative<TFloatArrayType>(m_Value);
+          return detail::holds<TFloatArrayType>(m_Value);
         case TValueType::BOOLEAN_ARRAY:
-          return std::holds_alternative<TBoolArrayType>(m_Value);
+          return detail::holds<TBoolArrayType>(m_Value);
         case TValueType::INTEGER_ARRAY:
-          return std::holds_alternative<TIntArrayType>(m_Value);
+          return detail::holds<TIntArrayType>(m_Value);
         case TValueType::ENUM_ARRAY:
-          return std::holds_alternative<TEnumArrayType>(m_Value);
+          return detail::holds<TEnumArrayType>(m_Value);
         case TValueType::STRING_ARRAY:
-          return std::holds_alternative<TStringArrayType>(m_Value);
+          return detail::holds<TStringArrayType>(m_Value);
         case TValueType::REFERENCE_COMPONENT:
-          return std::holds_alternative<TReferenceComponentType>(m_Value);
+          return detail::holds<TReferenceComponentType>(m_Value);
         case TValueType::FLOATING_POINT_MATRIX:
-          return std::holds_alternative<TFloatMatrixType>(m_Value);
+          return detail::holds<TFloatMatrixType>(m_Value);
         case TValueType::STRING_MATRIX:
-          return std::holds_alternative<TStringMatrixType>(m_Value);
+          return detail::holds<TStringMatrixType>(m_Value);
         case TValueType::ARRAY_OF_INTEGER_ARRAYS:
-          return std::holds_alternative<TArrayOfIntArraysType>(m_Value);
+          return detail::holds<TArrayOfIntArraysType>(m_Value);
       }
       return false;
     }
@@ -171,6 +171,17 @@ namespace rexsapi
   template<typename R>
   auto dispatch(TValueType type, const TValue& value, DispatcherFuncs<R> funcs);
 
+  /**
+   * @brief Calls the function matching the value type from an overload set of functions.
+   *
+   * The functions are called with a type tag and the value, just like with dispatch. As the functions are not type
+   * erased, the calls can be inlined. Calling visit for a value type without matching function throws a TException.
+   *
+   * @tparam R The return type of all functions
+   */
+  template<typename R, typename... Visitors>
+  R visit(TValueType type, const TValue& value, Visitors&&... visitors);
+
 
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
@@ -194,25 +205,25 @@ namespace rexsapi
                                [](const int64_t& i) -> std::string {
                                  return fmt::format("{}", i);
                                },
-                               [](const std::vector<double>&) -> std::string {
+                               [](const detail::TSharedValue<std::vector<double>>&) -> std::string {
                                  throw TException{"cannot convert vector to string"};
                                },
-                               [](const std::vector<Bool>&) -> std::string {
+                               [](const detail::TSharedValue<std::vector<Bool>>&) -> std::string {
                                  throw TException{"cannot convert vector to string"};
                                },
-                               [](const std::vector<int64_t>&) -> std::string {
+                               [](const detail::TSharedValue<std::vector<int64_t>>&) -> std::string {
                                  throw TException{"cannot convert vector to string"};
                                },
-                               [](const std::vector<std::string>&) -> std::string {
+                               [](const detail::TSharedValue<std::vector<std::string>>&) -> std::string {
                                  throw TException{"cannot convert vector to string"};
                                },
-                               [](const std::vector<std::vector<int64_t>>&) -> std::string {
+                               [](const detail::TSharedValue<std::vector<std::vector<int64_t>>>&) -> std::string {
                                  throw TException{"cannot convert vector to string"};
                                },
-                               [](const TMatrix<double>&) -> std::string {
+                               [](const detail::TSharedValue<TMatrix<double>>&) -> std::string {
                                  throw TException{"cannot convert matrix to string"};
                                },
-                               [](const TMatrix<std::string>&) -> std::string {
+                               [](const detail::TSharedValue<TMatrix<std::string>>&) -> std::string {
                                  throw TException{"cannot convert matrix to string"};
                                }},
                       m_Value);
@@ -334,6 +345,62 @@ namespace rexsapi
     }
     throw TException{fmt::format("no function set for {}", toTypeString(type))};
   }
+
+  namespace detail
+  {
+    template<typename R, typename Tag, typename T, typename Visitor>
+    inline R visitValue(TValueType type, [[maybe_unused]] const TValue& value, Visitor& visitor)
+    {
+      if constexpr (std::is_invocable_v<Visitor&, Tag, decltype(value.getValue<T>())>) {
+        return visitor(Tag(), value.getValue<T>());
+      } else {
+        throw TException{fmt::format("no function set for {}", toTypeString(type))};
+      }
+    }
+  }
+
+  template<typename R, typename... Visitors>
+  inline R visit(TValueType type, const TValue& value, Visitors&&... visitors)
+  {
+    overload visitor{std::forward<Visitors>(visitors)...};
+    try {
+      switch (type) {
+        case TValueType::FLOATING_POINT:
+          return detail::visitValue<R, FloatTag, TFloatType>(type, value, visitor);
+        case TValueType::BOOLEAN:
+          return detail::visitValue<R, BoolTag, TBoolType>(type, value, visitor);
+        case TValueType::INTEGER:
+          return detail::visitValue<R, IntTag, TIntType>(type, value, visitor);
+        case TValueType::ENUM:
+          return detail::visitValue<R, EnumTag, TEnumType>(type, value, visitor);
+        case TValueType::STRING:
+          return detail::visitValue<R, StringTag, TStringType>(type, value, visitor);
+        case TValueType::FILE_REFERENCE:
+          return detail::visitValue<R, FileReferenceTag, TFileReferenceType>(type, value, visitor);
+        case TValueType::FLOATING_POINT_ARRAY:
+          return detail::visitValue<R, FloatArrayTag, TFloatArrayType>(type, value, visitor);
+        case TValueType::BOOLEAN_ARRAY:
+          return detail::visitValue<R, BoolArrayTag, TBoolArrayType>(type, value, visitor);
+        case TValueType::INTEGER_ARRAY:
+          return detail::visitValue<R, IntArrayTag, TIntArrayType>(type, value, visitor);
+        case TValueType::ENUM_ARRAY:
+          return detail::visitValue<R, EnumArrayTag, TEnumArrayType>(type, value, visitor);
+        case TValueType::STRING_ARRAY:
+          return detail::visitValue<R, StringArrayTag, TStringArrayType>(type, value, visitor);
+        case TValueType::REFERENCE_COMPONENT:
+          return detail::visitValue<R, ReferenceComponentTag, TReferenceComponentType>(type, value, visitor);
+        case TValueType::FLOATING_POINT_MATRIX:
+          return detail::visitValue<R, FloatMatrixTag, TFloatMatrixType>(type, value, visitor);
+        case TValueType::STRING_MATRIX:
+          return detail::visitValue<R, StringMatrixTag, TStringMatrixType>(type, value, visitor);
+        case TValueType::ARRAY_OF_INTEGER_ARRAYS:
+          return detail::visitValue<R, ArrayOfIntArraysTag, TArrayOfIntArraysType>(type, value, visitor);
+      }
+    } catch (const std::bad_variant_access&) {
+      throw TException{fmt::format("wrong value {} for type {}", value.asString(), toTypeString(type))};
+    }
+    throw TException{fmt::format("no function set for {}", toTypeString(type))};
+  }
 }
 
 #endif
@@ -19,6 +19,7 @@
 
 #include <rexsapi/Types.hxx>
 
+#include <memory>
 #include <variant>
 
 namespace rexsapi
@@ -32,14 +33,108 @@ namespace rexsapi
 
   namespace detail
   {
-    using Variant = std::variant<std::monostate, double, bool, int64_t, std::string, std::vector<double>,
-                                 std::vector<Bool>, std::vector<int64_t>, std::vector<std::string>,
-                                 std::vector<std::vector<int64_t>>, TMatrix<double>, TMatrix<std::string>>;
+    /**
+     * @brief Immutable, reference counted storage for array and matrix values.
+     *
+     * Copies share the payload, so copying a value is O(1) regardless of its size. The payload is never modified,
+     * assigning a new value to a TValue replaces the shared payload instead. Strings are stored inline, most of them
+     * fit into the small string buffer and sharing them would cost an additional allocation.
+     */
+    template<typename T>
+    class TSharedValue
+    {
+    public:
+      explicit TSharedValue(T value)
+      : m_Value{std::make_shared<const T>(std::move(value))}
+      {
+      }
+
+      const T& get() const noexcept
+      {
+        return *m_Value;
+      }
+
+      friend bool operator==(const TSharedValue<T>& lhs, const TSharedValue<T>& rhs)
+      {
+        return lhs.m_Value == rhs.m_Value || *lhs.m_Value == *rhs.m_Value;
+      }
+
+    private:
+      std::shared_ptr<const T> m_Value;
+    };
+
+    template<typename T>
+    struct TStorage {
+      using Type = T;
+    };
+
+    template<>
+    struct TStorage<std::vector<double>> {
+      using Type = TSharedValue<std::vector<double>>;
+    };
+
+    template<>
+    struct TStorage<std::vector<Bool>> {
+      using Type = TSharedValue<std::vector<Bool>>;
+    };
+
+    template<>
+    struct TStorage<std::vector<int64_t>> {
+      using Type = TSharedValue<std::vector<int64_t>>;
+    };
+
+    template<>
+    struct TStorage<std::vector<std::string>> {
+      using Type = TSharedValue<std::vector<std::string>>;
+    };
+
+    template<>
+    struct TStorage<std::vector<std::vector<int64_t>>> {
+      using Type = TSharedValue<std::vector<std::vector<int64_t>>>;
+    };
+
+    template<>
+    struct TStorage<TMatrix<double>> {
+      using Type = TSharedValue<TMatrix<double>>;
+    };
+
+    template<>
+    struct TStorage<TMatrix<std::string>> {
+      using Type = TSharedValue<TMatrix<std::string>>;
+    };
+
+    using Variant =
+      std::variant<std::monostate, double, bool, int64_t, TStorage<std::string>::Type,
+                   TStorage<std::vector<double>>::Type, TStorage<std::vector<Bool>>::Type,
+                   TStorage<std::vector<int64_t>>::Type, TStorage<std::vector<std::string>>::Type,
+                   TStorage<std::vector<std::vector<int64_t>>>::Type, TStorage<TMatrix<double>>::Type,
+                   TStorage<TMatrix<std::string>>::Type>;
+
+    template<typename T>
+    inline decltype(auto) to_storage(T&& value)
+    {
+      using Type = std::decay_t<T>;
+      if constexpr (std::is_same_v<typename TStorage<Type>::Type, Type>) {
+        return std::forward<T>(value);
+      } else {
+        return typename TStorage<Type>::Type{std::forward<T>(value)};
+      }
+    }
+
+    template<typename T>
+    inline bool holds(const Variant& value)
+    {
+      return std::holds_alternative<typename TStorage<T>::Type>(value);
+    }
 
     template<typename T>
     inline const auto& value_getter(const Variant& value)
     {
-      return std::get<T>(value);
+      if constexpr (std::is_same_v<typename TStorage<T>::Type, T>) {
+        return std::get<T>(value);
+      } else {
+        return std::get<typename TStorage<T>::Type>(value).get();
+      }
     }
 
     template<>
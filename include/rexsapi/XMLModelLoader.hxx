@@ -18,12 +18,14 @@
 #define REXSAPI_XML_MODEL_LOADER_HXX
 
 #include <rexsapi/ConversionHelper.hxx>
+#include <rexsapi/LoadOptions.hxx>
 #include <rexsapi/ModelHelper.hxx>
 #include <rexsapi/XMLValueDecoder.hxx>
 #include <rexsapi/XSDSchemaValidator.hxx>
 #include <rexsapi/XmlUtils.hxx>
 #include <rexsapi/database/ModelRegistry.hxx>
 
+#include <exception>
 #include <set>
 
 namespace rexsapi
@@ -31,10 +33,13 @@ namespace rexsapi
   class TXMLModelLoader
   {
   public:
-    explicit TXMLModelLoader(TMode mode, const xml::TXSDSchemaValidator& validator)
+    explicit TXMLModelLoader(TMode mode, const xml::TXSDSchemaValidator& validator, const TLoadOptions& options = {})
     : m_Mode{mode}
+    , m_DecodeMode{options.m_DecodeMode}
+    , m_ValidationMode{options.m_ValidationMode}
     , m_Validator{validator}
-    , m_LoaderHelper{mode}
+    , m_LoaderHelper{mode, options.m_DecodeMode}
+    , m_Statistics{options.m_Statistics}
     {
     }
 
@@ -42,13 +47,24 @@ namespace rexsapi
                                std::vector<uint8_t>& buffer) const;
 
   private:
+    struct TSource {
+      std::vector<uint8_t> m_Buffer;
+      pugi::xml_document m_Document;
+    };
+
+    std::optional<TModel> build(TResult& result, const database::TModelRegistry& registry,
+                                const std::shared_ptr<const TSource>& source, xml::TSchemaTraversal& traversal) const;
+
     TAttributes getAttributes(const std::string& context, TResult& result, const std::string& componentId,
-                              const database::TComponent& componentType,
-                              const pugi::xpath_node_set& attributeNodes) const;
+                              const database::TComponent& componentType, const pugi::xml_node& component,
+                              const std::shared_ptr<const TSource>& source) const;
 
     TModeAdapter m_Mode;
+    TDecodeMode m_DecodeMode;
+    TValidationMode m_ValidationMode;
     const xml::TXSDSchemaValidator& m_Validator;
     TModelHelper<TXMLValueDecoder> m_LoaderHelper;
+    TLoadStatistics* m_Statistics;
   };
 
 
@@ -59,12 +75,78 @@ namespace rexsapi
   inline std::optional<TModel> TXMLModelLoader::load(TResult& result, const database::TModelRegistry& registry,
                                                      std::vector<uint8_t>& buffer) const
   {
-    const pugi::xml_document doc = loadXMLDocument(result, buffer, m_Validator);
+    // ATTENTION: the document is parsed in place, deferred values need their own copy of the buffer
+    auto source = std::make_shared<TSource>();
+    if (m_DecodeMode == TDecodeMode::LAZY) {
+      source->m_Buffer = buffer;
+    }
+    auto& documentBuffer = m_DecodeMode == TDecodeMode::LAZY ? source->m_Buffer : buffer;
+
+    {
+      TLoadStatistics::TScope scope{m_Statistics, TLoadPhase::PARSE, documentBuffer.size()};
+      source->m_Document = xml::loadXMLDocument(result, documentBuffer);
+    }
     if (!result) {
       return {};
     }
 
-    const auto rexsModel = *doc.select_nodes("/model").begin();
+    if (m_ValidationMode == TValidationMode::SEPARATE) {
+      {
+        TLoadStatistics::TScope scope{m_Statistics, TLoadPhase::SCHEMA_VALIDATION};
+        xml::validateXMLDocument(result, source->m_Document, m_Validator);
+        scope.elements(result.getErrors().size());
+      }
+      if (!result) {
+        return {};
+      }
+      xml::TSchemaTraversal traversal;
+      return build(result, registry, source, traversal);
+    }
+
+    // issues found while building a document that does not comply to the schema are not reported
+    xml::TSchemaTraversal traversal{m_Validator, source->m_Document};
+    TResult buildResult;
+    std::optional<TModel> model;
+    std::exception_ptr exception;
+    try {
+      model = build(buildResult, registry, source, traversal);
+    } catch (const std::exception&) {
+      exception = std::current_exception();
+    }
+
+    std::vector<std::string> errors;
+    bool valid;
+    {
+      // ATTENTION: the checks done while building are part of the value decoding and relations phases
+      TLoadStatistics::TScope scope{m_Statistics, TLoadPhase::SCHEMA_VALIDATION};
+      valid = traversal.finish(errors);
+      scope.elements(errors.size());
+    }
+    if (!valid) {
+      for (const auto& error : errors) {
+        result.addError(TError{TErrorLevel::CRIT, error});
+      }
+      return {};
+    }
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+    for (const auto& error : buildResult.getErrors()) {
+      result.addError(error);
+    }
+
+    return model;
+  }
+
+  inline std::optional<TModel> TXMLModelLoader::build(TResult& result, const database::TModelRegistry& registry,
+                                                      const std::shared_ptr<const TSource>& source,
+                                                      xml::TSchemaTraversal& traversal) const
+  {
+    using TScope = xml::TSchemaTraversal::TScope;
+
+    const auto rexsModel = source->m_Document.child("model");
+    const TScope modelScope{traversal, rexsModel};
+
     auto language = xml::getStringAttribute(rexsModel, "applicationLanguage", "");
     TModelInfo info{
       xml::getStringAttribute(rexsModel, "applicationId"), xml::getStringAttribute(rexsModel, "applicationVersion"),
@@ -80,83 +162,106 @@ namespace rexsapi
     components.reserve(10);
     std::set<uint64_t> usedComponents;
 
-    for (const auto& component : doc.select_nodes("/model/components/component")) {
-      auto componentId = xml::getStringAttribute(component, "id");
-      std::string componentName = xml::getStringAttribute(component, "name", "");
-      try {
-        const auto& componentType = dbModel.findComponentById(xml::getStringAttribute(component, "type"));
-
-        const auto attributeNodes =
-          doc.select_nodes(fmt::format("/model/components/component[@id = '{}']/attribute", componentId).c_str());
-        std::string context = componentName.empty() ? componentType.getName() : componentName;
-        TAttributes attributes = getAttributes(context, result, componentId, componentType, attributeNodes);
-
-        components.emplace_back(TComponent{componentsMapping.addComponent(convertToUint64(componentId)),
-                                           componentType.getComponentId(), componentName, std::move(attributes)});
-      } catch (const std::exception& ex) {
-        result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
+    TLoadStatistics::TScope decodingPhase{m_Statistics, TLoadPhase::VALUE_DECODING};
+    uint64_t attributeCount{0};
+    for (const auto& componentsNode : rexsModel.children("components")) {
+      const TScope componentsScope{traversal, componentsNode};
+      for (const auto& component : componentsNode.children("component")) {
+        const TScope componentScope{traversal, component};
+        auto componentId = xml::getStringAttribute(component, "id");
+        std::string componentName = xml::getStringAttribute(component, "name", "");
+        try {
+          const auto& componentType = dbModel.findComponentById(xml::getStringAttribute(component, "type"));
+
+          std::string context = componentName.empty() ? componentType.getName() : componentName;
+          TAttributes attributes = getAttributes(context, result, componentId, componentType, component, source);
+          attributeCount += attributes.size();
+
+          components.emplace_back(TComponent{componentsMapping.addComponent(convertToUint64(componentId)),
+                                             componentType.getComponentId(), componentName, std::move(attributes)});
+        } catch (const std::exception& ex) {
+          result.addError(
+            TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
+        }
       }
     }
-    ComponentPostProcessor postProcessor{result, m_Mode, components, componentsMapping};
-    components = postProcessor.release();
+    decodingPhase.elements(attributeCount);
+    decodingPhase.finish();
 
+    {
+      TLoadStatistics::TScope scope{m_Statistics, TLoadPhase::REFERENCES};
+      ComponentPostProcessor postProcessor{result, m_Mode, std::move(components), componentsMapping};
+      components = postProcessor.release();
+      scope.elements(components.size());
+    }
+
+    TLoadStatistics::TScope relationsPhase{m_Statistics, TLoadPhase::RELATIONS};
     TRelations relations;
-    for (const auto& relation : doc.select_nodes("/model/relations/relation")) {
-      std::string relationId = xml::getStringAttribute(relation, "id");
-      try {
-        auto relationType = relationTypeFromString(xml::getStringAttribute(relation, "type"));
-        std::optional<uint32_t> order;
-        if (const auto orderAtt = relation.node().attribute("order"); !orderAtt.empty()) {
-          order = orderAtt.as_uint();
-          if (order.value() < 1) {
-            result.addError(
-              TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("relation id={} order is <1", relationId)});
+    for (const auto& relationsNode : rexsModel.children("relations")) {
+      const TScope relationsScope{traversal, relationsNode};
+      for (const auto& relation : relationsNode.children("relation")) {
+        const TScope relationScope{traversal, relation};
+        std::string relationId = xml::getStringAttribute(relation, "id");
+        try {
+          auto relationType = relationTypeFromString(xml::getStringAttribute(relation, "type"));
+          std::optional<uint32_t> order;
+          if (const auto orderAtt = relation.attribute("order"); !orderAtt.empty()) {
+            order = orderAtt.as_uint();
+            if (order.value() < 1) {
+              result.addError(
+                TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("relation id={} order is <1", relationId)});
+            }
           }
-        }
 
-        TRelationReferences references;
-        for (const auto& reference :
-             doc.select_nodes(fmt::format("/model/relations/relation[@id = '{}']/ref", relationId).c_str())) {
-          std::string referenceId = xml::getStringAttribute(reference, "id");
-          try {
-            auto role = relationRoleFromString(xml::getStringAttribute(reference, "role"));
-            std::string hint = xml::getStringAttribute(reference, "hint", "");
-
-            const auto* component = componentsMapping.getComponent(convertToUint64(referenceId), components);
-            if (component == nullptr) {
-              result.addError(TError{
-                m_Mode.adapt(TErrorLevel::ERR),
-                fmt::format("relation id={} referenced component id={} does not exist", relationId, referenceId)});
-              continue;
+          TRelationReferences references;
+          for (const auto& reference : relation.children("ref")) {
+            const TScope referenceScope{traversal, reference};
+            std::string referenceId = xml::getStringAttribute(reference, "id");
+            try {
+              auto role = relationRoleFromString(xml::getStringAttribute(reference, "role"));
+              std::string hint = xml::getStringAttribute(reference, "hint", "");
+
+              const auto* component = componentsMapping.getComponent(convertToUint64(referenceId), components);
+              if (component == nullptr) {
+                result.addError(TError{
+                  m_Mode.adapt(TErrorLevel::ERR),
+                  fmt::format("relation id={} referenced component id={} does not exist", relationId, referenceId)});
+                continue;
+              }
+              usedComponents.emplace(component->getInternalId());
+              references.emplace_back(TRelationReference{role, hint, *component});
+            } catch (const std::exception& ex) {
+              result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                                     fmt::format("cannot process reference id={}: {}", referenceId, ex.what())});
             }
-            usedComponents.emplace(component->getInternalId());
-            references.emplace_back(TRelationReference{role, hint, *component});
-          } catch (const std::exception& ex) {
-            result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                   fmt::format("cannot process reference id={}: {}", referenceId, ex.what())});
           }
-        }
 
-        relations.emplace_back(TRelation{relationType, order, std::move(references)});
-      } catch (const std::exception& ex) {
-        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                               fmt::format("cannot process relation id={}: {}", relationId, ex.what())});
+          relations.emplace_back(TRelation{relationType, order, std::move(references)});
+        } catch (const std::exception& ex) {
+          result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                                 fmt::format("cannot process relation id={}: {}", relationId, ex.what())});
+        }
       }
     }
     if (usedComponents.size() != components.size()) {
       result.addError(TError{TErrorLevel::WARN, fmt::format("{} components are not used in a relation",
                                                             components.size() - usedComponents.size())});
     }
+    relationsPhase.elements(relations.size());
+    relationsPhase.finish();
 
+    TLoadStatistics::TScope loadSpectrumPhase{m_Statistics, TLoadPhase::LOAD_SPECTRUM};
     TLoadCases loadCases;
-    {
-      for (const auto& loadCase : doc.select_nodes("/model/load_spectrum/load_case")) {
+    TLoadComponents accumulationComponents;
+    for (const auto& loadSpectrum : rexsModel.children("load_spectrum")) {
+      const TScope loadSpectrumScope{traversal, loadSpectrum};
+      for (const auto& loadCase : loadSpectrum.children("load_case")) {
+        const TScope loadCaseScope{traversal, loadCase};
         std::string loadCaseId = xml::getStringAttribute(loadCase, "id");
         TLoadComponents loadComponents;
 
-        for (const auto& component : doc.select_nodes(
-               fmt::format("/model/load_spectrum/load_case[@id = '{}']/component", loadCaseId).c_str())) {
+        for (const auto& component : loadCase.children("component")) {
+          const TScope componentScope{traversal, component};
           auto componentId = xml::getStringAttribute(component, "id");
           try {
             const auto* refComponent = componentsMapping.getComponent(convertToUint64(componentId), components);
@@ -167,14 +272,11 @@ namespace rexsapi
               continue;
             }
 
-            const auto attributeNodes =
-              doc.select_nodes(fmt::format("/model/load_spectrum/load_case[@id = '{}']/component[@id = '{}']/attribute",
-                                           loadCaseId, componentId)
-                                 .c_str());
             const auto context = fmt::format("load_case id={}", loadCaseId);
-            TAttributes attributes = getAttributes(context, result, componentId,
-                                                   dbModel.findComponentById(refComponent->getType()), attributeNodes);
+            TAttributes attributes = getAttributes(
+              context, result, componentId, dbModel.findComponentById(refComponent->getType()), component, source);
             loadComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
+            loadSpectrumPhase.addElements(1);
           } catch (const std::exception& ex) {
             result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("load_case id={} component id={}: {}",
                                                                                loadCaseId, componentId, ex.what())});
@@ -182,33 +284,35 @@ namespace rexsapi
         }
         loadCases.emplace_back(std::move(loadComponents));
       }
-    }
-    std::optional<TAccumulation> accumulation;
-    {
-      TLoadComponents loadComponents;
-      for (const auto& component : doc.select_nodes("/model/load_spectrum/accumulation/component")) {
-        auto componentId = xml::getStringAttribute(component, "id");
-        try {
-          const auto* refComponent = componentsMapping.getComponent(convertToUint64(componentId), components);
-          if (refComponent == nullptr) {
+
+      for (const auto& accumulationNode : loadSpectrum.children("accumulation")) {
+        const TScope accumulationScope{traversal, accumulationNode};
+        for (const auto& component : accumulationNode.children("component")) {
+          const TScope componentScope{traversal, component};
+          auto componentId = xml::getStringAttribute(component, "id");
+          try {
+            const auto* refComponent = componentsMapping.getComponent(convertToUint64(componentId), components);
+            if (refComponent == nullptr) {
+              result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                                     fmt::format("accumulation component id={} does not exist", componentId)});
+              continue;
+            }
+
+            TAttributes attributes =
+              getAttributes("accumulation", result, componentId, dbModel.findComponentById(refComponent->getType()),
+                            component, source);
+            accumulationComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
+            loadSpectrumPhase.addElements(1);
+          } catch (const std::exception& ex) {
             result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                   fmt::format("accumulation component id={} does not exist", componentId)});
-            continue;
+                                   fmt::format("accumulation component id={}: {}", componentId, ex.what())});
           }
-
-          const auto attributeNodes = doc.select_nodes(
-            fmt::format("/model/load_spectrum/accumulation/component[@id = '{}']/attribute", componentId).c_str());
-          TAttributes attributes = getAttributes("accumulation", result, componentId,
-                                                 dbModel.findComponentById(refComponent->getType()), attributeNodes);
-          loadComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
-        } catch (const std::exception& ex) {
-          result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                 fmt::format("accumulation component id={}: {}", componentId, ex.what())});
         }
       }
-      if (!loadComponents.empty()) {
-        accumulation = TAccumulation{std::move(loadComponents)};
-      }
+    }
+    std::optional<TAccumulation> accumulation;
+    if (!accumulationComponents.empty()) {
+      accumulation = TAccumulation{std::move(accumulationComponents)};
     }
 
     return TModel{info, std::move(components), std::move(relations),
@@ -218,10 +322,11 @@ namespace rexsapi
   inline TAttributes TXMLModelLoader::getAttributes(const std::string& context, TResult& result,
                                                     const std::string& componentId,
                                                     const database::TComponent& componentType,
-                                                    const pugi::xpath_node_set& attributeNodes) const
+                                                    const pugi::xml_node& component,
+                                                    const std::shared_ptr<const TSource>& source) const
   {
     TAttributes attributes;
-    for (const auto& attribute : attributeNodes) {
+    for (const auto& attribute : component.children("attribute")) {
       std::string id = xml::getStringAttribute(attribute, "id");
       auto unit = xml::getStringAttribute(attribute, "unit");
 
@@ -241,10 +346,17 @@ namespace rexsapi
           }
         }
 
-        auto value = m_LoaderHelper.getValue(result, context, id, convertToUint64(componentId), att, attribute.node());
-        attributes.emplace_back(TAttribute{att, TUnit{att.getUnit()}, value});
+        if (m_LoaderHelper.isLazy(att.getValueType())) {
+          attributes.emplace_back(TAttribute{att, TUnit{att.getUnit()},
+                                             m_LoaderHelper.getLazyValue(context, id, convertToUint64(componentId), att,
+                                                                         attribute, source)});
+        } else {
+          auto value =
+            m_LoaderHelper.getValue(result, context, id, convertToUint64(componentId), att, attribute);
+          attributes.emplace_back(TAttribute{att, TUnit{att.getUnit()}, value});
+        }
       } else {
-        auto [value, type] = m_LoaderHelper.getDecoder().decodeUnknown(attribute.node());
+        auto [value, type] = m_LoaderHelper.getDecoder().decodeUnknown(attribute);
         attributes.emplace_back(TAttribute{id, TUnit{unit}, type, std::move(value)});
       }
     }
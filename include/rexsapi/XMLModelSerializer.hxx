@@ -208,85 +208,85 @@ namespace rexsapi
       return;
     }
 
-    rexsapi::dispatch<void>(
+    rexsapi::visit<void>(
       attribute.getValueType(), attribute.getValue(),
-      {[&attNode](rexsapi::FloatTag, const auto& d) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(format(d).c_str());
-       },
-       [&attNode](rexsapi::BoolTag, const auto& b) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", b).c_str());
-       },
-       [&attNode](rexsapi::IntTag, const auto& i) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", i).c_str());
-       },
-       [&attNode](rexsapi::EnumTag, const auto& s) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
-       },
-       [&attNode](rexsapi::StringTag, const auto& s) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
-       },
-       [&attNode](rexsapi::FileReferenceTag, const auto& s) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
-       },
-       [&attNode, &attribute](rexsapi::FloatArrayTag, const auto& a) -> void {
-         xmlEncodeCodedArray(attNode, attribute.getValue(), a, [](double element) {
-           return format(element);
-         });
-       },
-       [&attNode](rexsapi::BoolArrayTag, const auto& a) -> void {
-         auto arrayNode = attNode.append_child("array");
-         for (const auto& element : a) {
-           auto child = arrayNode.append_child("c");
-           child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element.m_Value).c_str());
-         }
-       },
-       [&attNode, &attribute](rexsapi::IntArrayTag, const auto& a) -> void {
-         xmlEncodeCodedArray(attNode, attribute.getValue(), a, [](auto element) {
-           return fmt::format("{}", element);
-         });
-       },
-       [&attNode](rexsapi::EnumArrayTag, const auto& a) -> void {
-         auto arrayNode = attNode.append_child("array");
-         for (const auto& element : a) {
-           auto child = arrayNode.append_child("c");
-           child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element).c_str());
-         }
-       },
-       [&attNode](rexsapi::StringArrayTag, const auto& a) -> void {
-         auto arrayNode = attNode.append_child("array");
-         for (const auto& element : a) {
-           auto child = arrayNode.append_child("c");
-           child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element).c_str());
-         }
-       },
-       [&attNode](rexsapi::ReferenceComponentTag, const auto& n) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", n).c_str());
-       },
-       [&attNode, &attribute](rexsapi::FloatMatrixTag, const auto& m) -> void {
-         xmlEncodeCodedMatrix(attNode, attribute.getValue(), m, [](double element) {
-           return format(element);
-         });
-       },
-       [&attNode](rexsapi::StringMatrixTag, const auto& m) -> void {
-         auto matrixNode = attNode.append_child("matrix");
-         for (const auto& row : m.m_Values) {
-           auto rowNode = matrixNode.append_child("r");
-           for (const auto& column : row) {
-             auto child = rowNode.append_child("c");
-             child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", column).c_str());
-           }
-         }
-       },
-       [&attNode](rexsapi::ArrayOfIntArraysTag, const auto& a) -> void {
-         auto arraysNode = attNode.append_child("array_of_arrays");
-         for (const auto& array : a) {
-           auto aNode = arraysNode.append_child("array");
-           for (const auto& c : array) {
-             auto child = aNode.append_child("c");
-             child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", c).c_str());
-           }
-         }
-       }});
+      [&attNode](rexsapi::FloatTag, const auto& d) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(format(d).c_str());
+      },
+      [&attNode](rexsapi::BoolTag, const auto& b) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", b).c_str());
+      },
+      [&attNode](rexsapi::IntTag, const auto& i) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", i).c_str());
+      },
+      [&attNode](rexsapi::EnumTag, const auto& s) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
+      },
+      [&attNode](rexsapi::StringTag, const auto& s) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
+      },
+      [&attNode](rexsapi::FileReferenceTag, const auto& s) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
+      },
+      [&attNode, &attribute](rexsapi::FloatArrayTag, const auto& a) -> void {
+        xmlEncodeCodedArray(attNode, attribute.getValue(), a, [](double element) {
+          return format(element);
+        });
+      },
+      [&attNode](rexsapi::BoolArrayTag, const auto& a) -> void {
+        auto arrayNode = attNode.append_child("array");
+        for (const auto& element : a) {
+          auto child = arrayNode.append_child("c");
+          child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element.m_Value).c_str());
+        }
+      },
+      [&attNode, &attribute](rexsapi::IntArrayTag, const auto& a) -> void {
+        xmlEncodeCodedArray(attNode, attribute.getValue(), a, [](auto element) {
+          return fmt::format("{}", element);
+        });
+      },
+      [&attNode](rexsapi::EnumArrayTag, const auto& a) -> void {
+        auto arrayNode = attNode.append_child("array");
+        for (const auto& element : a) {
+          auto child = arrayNode.append_child("c");
+          child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element).c_str());
+        }
+      },
+      [&attNode](rexsapi::StringArrayTag, const auto& a) -> void {
+        auto arrayNode = attNode.append_child("array");
+        for (const auto& element : a) {
+          auto child = arrayNode.append_child("c");
+          child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element).c_str());
+        }
+      },
+      [&attNode](rexsapi::ReferenceComponentTag, const auto& n) -> void {
+        attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", n).c_str());
+      },
+      [&attNode, &attribute](rexsapi::FloatMatrixTag, const auto& m) -> void {
+        xmlEncodeCodedMatrix(attNode, attribute.getValue(), m, [](double element) {
+          return format(element);
+        });
+      },
+      [&attNode](rexsapi::StringMatrixTag, const auto& m) -> void {
+        auto matrixNode = attNode.append_child("matrix");
+        for (const auto& row : m.m_Values) {
+          auto rowNode = matrixNode.append_child("r");
+          for (const auto& column : row) {
+            auto child = rowNode.append_child("c");
+            child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", column).c_str());
+          }
+        }
+      },
+      [&attNode](rexsapi::ArrayOfIntArraysTag, const auto& a) -> void {
+        auto arraysNode = attNode.append_child("array_of_arrays");
+        for (const auto& array : a) {
+          auto aNode = arraysNode.append_child("array");
+          for (const auto& c : array) {
+            auto child = aNode.append_child("c");
+            child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", c).c_str());
+          }
+        }
+      });
   }
 
   inline void XMLModelSerializer::serialize(pugi::xml_node& loadSpectrumNode, const TLoadSpectrum& loadSpectrum)
@@ -18,6 +18,7 @@
 #define REXSAPI_XML_SERIALIZER_HXX
 
 #include <rexsapi/Xml.hxx>
+#include <rexsapi/ZipArchive.hxx>
 
 namespace rexsapi
 {
@@ -41,6 +42,32 @@ namespace rexsapi
   };
 
 
+  class XMLZipFileSerializer
+  {
+  public:
+    explicit XMLZipFileSerializer(std::filesystem::path file, int compressionLevel = MZ_DEFAULT_LEVEL)
+    : m_File{std::move(file)}
+    , m_CompressionLevel{compressionLevel}
+    {
+    }
+
+    void serialize(const pugi::xml_document& doc) const
+    {
+      ZipArchiveWriter writer{m_File, zipEntryName(m_File, TFileType::XML), m_CompressionLevel};
+      std::ostream stream{&writer};
+      doc.save(stream, "  ");
+      if (!stream) {
+        throw TException{fmt::format("Could not serialize model to {}", m_File.string())};
+      }
+      writer.close();
+    }
+
+  private:
+    std::filesystem::path m_File;
+    int m_CompressionLevel;
+  };
+
+
   class XMLStringSerializer
   {
   public:
@@ -20,13 +20,17 @@
 #include <rexsapi/ConversionHelper.hxx>
 #include <rexsapi/Exception.hxx>
 #include <rexsapi/Format.hxx>
+#include <rexsapi/SchemaValidatorCache.hxx>
 #include <rexsapi/Xml.hxx>
 
 #include <filesystem>
 #include <limits>
 #include <optional>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace rexsapi::xml
@@ -34,8 +38,12 @@ namespace rexsapi::xml
   static constexpr const char* xsdSchemaNS = "xsd";
 
   class TElement;
+  class TElementNames;
   class TValidationContext;
 
+  /// Child elements whose validation has been deferred to the caller
+  using TChildElements = std::vector<std::pair<const TElement*, pugi::xml_node>>;
+
 
   class TSimpleType
   {
@@ -81,6 +89,18 @@ namespace rexsapi::xml
 
     virtual void validate(const pugi::xml_node& node, TValidationContext& context) const = 0;
 
+    virtual void validateNode(const pugi::xml_node& node, TValidationContext& context,
+                              TChildElements& children) const
+    {
+      (void)children;
+      validate(node, context);
+    }
+
+    virtual void compile(TElementNames& names)
+    {
+      (void)names;
+    }
+
     [[nodiscard]] const std::string& getName() const&
     {
       return m_Name;
@@ -118,12 +138,49 @@ namespace rexsapi::xml
 
     void validate(const pugi::xml_node& node, TValidationContext& context) const;
 
+    /**
+     * @brief Validates the node without descending into its child elements.
+     *
+     * The child elements that would have been validated are added to children instead.
+     */
+    void validateNode(const pugi::xml_node& node, TValidationContext& context, TChildElements& children) const;
+
+    void compile(TElementNames& names);
+
   private:
     std::string m_Name;
     TElementType::Ptr m_Type;
   };
 
 
+  /**
+   * @brief Interns the names of all elements of a schema to dense integer ids.
+   *
+   * Sequences use the ids to look up child elements in precomputed tables instead of comparing names.
+   */
+  class TElementNames
+  {
+  public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    size_t registerElement(const TElement& element);
+
+    size_t registerName(const std::string& name);
+
+    [[nodiscard]] size_t find(std::string_view name) const;
+
+    [[nodiscard]] bool isGlobalElement(size_t id) const;
+
+  private:
+    // ATTENTION: the keys reference the names of the elements owned by the schema
+    std::unordered_map<std::string_view, size_t> m_Ids;
+    std::vector<const TElement*> m_Elements;
+  };
+
+
+  /// The matching child nodes of a sequence together with their slot in the sequence
+  using TChildNodes = std::vector<std::pair<size_t, pugi::xml_node>>;
+
   class TElementRef
   {
   public:
@@ -136,12 +193,24 @@ namespace rexsapi::xml
 
     [[nodiscard]] const std::string& getName() const&;
 
-    void validate(const pugi::xml_node& node, TValidationContext& context) const;
+    [[nodiscard]] size_t getSlot() const
+    {
+      return m_Slot;
+    }
+
+    void setSlot(size_t slot)
+    {
+      m_Slot = slot;
+    }
+
+    void validate(const TChildNodes& children, uint64_t count, TValidationContext& context,
+                  TChildElements* deferred) const;
 
   private:
     const TElement& m_Element;
     uint64_t m_Min;
     uint64_t m_Max;
+    size_t m_Slot{TElementNames::npos};
   };
 
 
@@ -151,13 +220,16 @@ namespace rexsapi::xml
     void addElementRef(const TElement& element, uint64_t min, uint64_t max);
     void addDirectElement(const std::string& name, const TSimpleType& type, uint64_t min, uint64_t max);
 
-    void validate(const pugi::xml_node& node, TValidationContext& context) const;
+    void compile(TElementNames& names);
 
-  private:
-    [[nodiscard]] bool checkContainsElement(const std::string& child) const;
+    void validate(const pugi::xml_node& node, TValidationContext& context, TChildElements* deferred) const;
 
+  private:
     std::vector<TElementRef> m_Elements;
     std::unordered_map<std::string, TElement> m_DirectElements;
+    // maps element ids to the slots of this sequence, elements with the same name share a slot
+    std::vector<size_t> m_Slots;
+    size_t m_SlotCount{0};
   };
 
 
@@ -197,7 +269,7 @@ namespace rexsapi::xml
     void validate(const pugi::xml_node& node, TValidationContext& context) const;
 
   private:
-    [[nodiscard]] bool containsAttribute(const std::string& attribute) const;
+    [[nodiscard]] bool containsAttribute(std::string_view attribute) const;
 
     TAttributeMode m_Relaxed{TAttributeMode::STRICT};
     std::vector<TAttribute> m_Attributes;
@@ -223,7 +295,14 @@ namespace rexsapi::xml
 
     void validate(const pugi::xml_node& node, TValidationContext& context) const override;
 
+    void validateNode(const pugi::xml_node& node, TValidationContext& context,
+                      TChildElements& children) const override;
+
+    void compile(TElementNames& names) override;
+
   private:
+    void validate(const pugi::xml_node& node, TValidationContext& context, TChildElements* deferred) const;
+
     TSequence m_Sequence;
     TAttributes m_Attributes;
     std::optional<TText> m_Text;
@@ -279,6 +358,8 @@ namespace rexsapi::xml
     [[nodiscard]] bool validate(const pugi::xml_document& doc, std::vector<std::string>& errors) const;
 
   private:
+    friend class TSchemaTraversal;
+
     void init();
     void initTypes();
 
@@ -293,6 +374,7 @@ namespace rexsapi::xml
     pugi::xml_document m_Doc;
     TSimpleTypes m_Types;
     TElements m_Elements;
+    TElementNames m_Names;
   };
 
 
@@ -309,6 +391,11 @@ namespace rexsapi::xml
 
     [[nodiscard]] pugi::xml_document load() const;
 
+    [[nodiscard]] const std::filesystem::path& getPath() const noexcept
+    {
+      return m_XsdSchema;
+    }
+
   private:
     std::filesystem::path m_XsdSchema;
   };
@@ -334,12 +421,15 @@ namespace rexsapi::xml
   };
 
 
+  using TXSDSchemaValidatorCache = TSchemaValidatorCache<TXSDSchemaValidator, TBufferXsdSchemaLoader>;
+
+
   class TEnumeration
   {
   public:
     explicit TEnumeration(std::string name, std::vector<std::string> enumValues)
     : m_Name{std::move(name)}
-    , m_EnumValues{std::move(enumValues)}
+    , m_EnumValues{std::make_move_iterator(enumValues.begin()), std::make_move_iterator(enumValues.end())}
     {
     }
 
@@ -347,7 +437,7 @@ namespace rexsapi::xml
 
   private:
     std::string m_Name;
-    std::vector<std::string> m_EnumValues;
+    std::unordered_set<std::string> m_EnumValues;
   };
 
 
@@ -412,9 +502,20 @@ namespace rexsapi::xml
     {
     }
 
+    TValidationContext(const TElements& elements, const TElementNames& names)
+    : m_Elements{elements}
+    , m_Names{&names}
+    {
+    }
+
     [[nodiscard]] const TElement* findElement(const std::string& name) const&;
 
-    void pushElement(std::string element);
+    [[nodiscard]] size_t findElementId(std::string_view name) const;
+
+    [[nodiscard]] bool isGlobalElement(size_t id) const;
+
+    // ATTENTION: the element name has to outlive the validation
+    void pushElement(const std::string& element);
 
     void popElement();
 
@@ -428,7 +529,8 @@ namespace rexsapi::xml
 
   private:
     const TElements& m_Elements;
-    std::vector<std::string> m_ElementStack;
+    const TElementNames* m_Names{nullptr};
+    std::vector<const std::string*> m_ElementStack;
     std::vector<std::string> m_Errors;
   };
 
@@ -449,6 +551,68 @@ namespace rexsapi::xml
   };
 
 
+  /**
+   * @brief Checks a document against a schema while a loader traverses the document.
+   *
+   * Entering a node checks the node itself, but does not descend into its child elements. Child elements that have
+   * not been entered are validated completely when their parent is left. Hence, the traversal reports the same issues
+   * as TXSDSchemaValidator::validate, albeit in a different order. A default constructed traversal checks nothing.
+   */
+  class TSchemaTraversal
+  {
+  public:
+    class TScope
+    {
+    public:
+      TScope(TSchemaTraversal& traversal, const pugi::xml_node& node)
+      : m_Traversal{traversal}
+      {
+        m_Traversal.enter(node);
+      }
+
+      ~TScope()
+      {
+        m_Traversal.leave();
+      }
+
+      TScope(const TScope&) = delete;
+      TScope& operator=(const TScope&) = delete;
+      TScope(TScope&&) = delete;
+      TScope& operator=(TScope&&) = delete;
+
+    private:
+      TSchemaTraversal& m_Traversal;
+    };
+
+    TSchemaTraversal() = default;
+
+    TSchemaTraversal(const TXSDSchemaValidator& validator, const pugi::xml_document& doc);
+
+    void enter(const pugi::xml_node& node);
+
+    void leave();
+
+    /**
+     * @brief Validates all nodes that have not been entered and ends the traversal.
+     *
+     * @return true if the document is valid
+     */
+    [[nodiscard]] bool finish(std::vector<std::string>& errors);
+
+  private:
+    struct TFrame {
+      const TElement* m_Element{nullptr};
+      TChildElements m_Children;
+      size_t m_Next{0};
+    };
+
+    void validateRemaining(const TFrame& frame);
+
+    std::optional<TValidationContext> m_Context;
+    std::vector<TFrame> m_Frames;
+  };
+
+
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
@@ -520,41 +684,64 @@ namespace rexsapi::xml
     addElementRef(iter->second, min, max);
   }
 
-  inline void TSequence::validate(const pugi::xml_node& node, TValidationContext& context) const
+  inline void TSequence::compile(TElementNames& names)
+  {
+    for (const auto& [name, element] : m_DirectElements) {
+      (void)names.registerName(element.getName());
+    }
+
+    m_Slots.clear();
+    m_SlotCount = 0;
+    for (auto& element : m_Elements) {
+      const auto id = names.find(element.getName());
+      if (id == TElementNames::npos) {
+        throw TException{fmt::format("element '{}' has not been registered", element.getName())};
+      }
+      if (id >= m_Slots.size()) {
+        m_Slots.resize(id + 1, TElementNames::npos);
+      }
+      if (m_Slots[id] == TElementNames::npos) {
+        m_Slots[id] = m_SlotCount++;
+      }
+      element.setSlot(m_Slots[id]);
+    }
+  }
+
+  inline void TSequence::validate(const pugi::xml_node& node, TValidationContext& context,
+                                  TChildElements* deferred) const
   {
+    std::vector<uint64_t> counts(m_SlotCount, 0);
+    TChildNodes children;
+
     for (const auto& child : node.children()) {
-      const std::string childName = child.name();
+      const std::string_view childName = child.name();
       if (childName.empty()) {
         continue;
       }
-      if (const auto* element = context.findElement(childName); element == nullptr) {
-        const auto it = std::find_if(m_DirectElements.begin(), m_DirectElements.end(), [&childName](const auto& item) {
-          return item.second.getName() == childName;
-        });
-        if (it == m_DirectElements.end()) {
+      const auto id = context.findElementId(childName);
+      const auto slot = id < m_Slots.size() ? m_Slots[id] : TElementNames::npos;
+      if (!context.isGlobalElement(id)) {
+        // only direct elements of this sequence have a slot without being a global element
+        if (slot == TElementNames::npos) {
           context.addError(fmt::format("unkown element '{}'", childName));
         }
-      } else if (!checkContainsElement(childName)) {
+      } else if (slot == TElementNames::npos) {
         context.addError(fmt::format("element '{}' is not allowed here", childName));
       }
+      if (slot != TElementNames::npos && child.type() == pugi::node_element) {
+        ++counts[slot];
+        children.emplace_back(slot, child);
+      }
     }
-    std::for_each(m_Elements.begin(), m_Elements.end(), [&node, &context](const auto& element) {
-      element.validate(node, context);
-    });
+    std::for_each(m_Elements.begin(), m_Elements.end(),
+                  [&children, &counts, &context, deferred](const auto& element) {
+                    element.validate(children, counts[element.getSlot()], context, deferred);
+                  });
     std::for_each(m_DirectElements.begin(), m_DirectElements.end(), [&node, &context](const auto& element) {
       element.second.validate(node, context);
     });
   }
 
-  [[nodiscard]] inline bool TSequence::checkContainsElement(const std::string& child) const
-  {
-    const auto it = std::find_if(m_Elements.begin(), m_Elements.end(), [&child](const auto& element) {
-      return child == element.getName();
-    });
-
-    return it != m_Elements.end();
-  }
-
   inline void TAttribute::validate(const pugi::xml_node& node, TValidationContext& context) const
   {
     const auto attribute = node.attribute(m_Name.c_str());
@@ -574,21 +761,27 @@ namespace rexsapi::xml
     return m_Element.getName();
   }
 
-  inline void TElementRef::validate(const pugi::xml_node& node, TValidationContext& context) const
+  inline void TElementRef::validate(const TChildNodes& children, uint64_t count, TValidationContext& context,
+                                    TChildElements* deferred) const
   {
-    const auto nodes = node.select_nodes(m_Element.getName().c_str());
-
-    if (nodes.size() < m_Min) {
-      context.addError(fmt::format("too few '{}' elements, found {} instead of at least {}", m_Element.getName(),
-                                   nodes.size(), m_Min));
+    if (count < m_Min) {
+      context.addError(
+        fmt::format("too few '{}' elements, found {} instead of at least {}", m_Element.getName(), count, m_Min));
     }
-    if (nodes.size() > m_Max) {
-      context.addError(fmt::format("too many '{}' elements, found {} instead of at most {}", m_Element.getName(),
-                                   nodes.size(), m_Max));
+    if (count > m_Max) {
+      context.addError(
+        fmt::format("too many '{}' elements, found {} instead of at most {}", m_Element.getName(), count, m_Max));
     }
 
-    for (const auto& child : nodes) {
-      m_Element.validate(child.node(), context);
+    for (const auto& [slot, child] : children) {
+      if (slot != m_Slot) {
+        continue;
+      }
+      if (deferred) {
+        deferred->emplace_back(&m_Element, child);
+      } else {
+        m_Element.validate(child, context);
+      }
     }
   }
 
@@ -617,7 +810,7 @@ namespace rexsapi::xml
     }
   }
 
-  inline bool TAttributes::containsAttribute(const std::string& attribute) const
+  inline bool TAttributes::containsAttribute(std::string_view attribute) const
   {
     const auto it = std::find_if(m_Attributes.begin(), m_Attributes.end(), [&attribute](const auto& att) {
       return att.getName() == attribute;
@@ -634,10 +827,27 @@ namespace rexsapi::xml
   }
 
 
+  inline void TComplexType::compile(TElementNames& names)
+  {
+    m_Sequence.compile(names);
+  }
+
   inline void TComplexType::validate(const pugi::xml_node& node, TValidationContext& context) const
+  {
+    validate(node, context, nullptr);
+  }
+
+  inline void TComplexType::validateNode(const pugi::xml_node& node, TValidationContext& context,
+                                         TChildElements& children) const
+  {
+    validate(node, context, &children);
+  }
+
+  inline void TComplexType::validate(const pugi::xml_node& node, TValidationContext& context,
+                                     TChildElements* deferred) const
   {
     m_Attributes.validate(node, context);
-    m_Sequence.validate(node, context);
+    m_Sequence.validate(node, context, deferred);
     if (m_Text) {
       m_Text->validate(node, context);
     } else {
@@ -670,10 +880,7 @@ namespace rexsapi::xml
 
   inline void TEnumeration::validate(const std::string& value, TValidationContext& context) const
   {
-    const auto it = std::find_if(m_EnumValues.begin(), m_EnumValues.end(), [&value](const auto& item) {
-      return item == value;
-    });
-    if (it == m_EnumValues.end()) {
+    if (m_EnumValues.find(value) == m_EnumValues.end()) {
       context.addError(fmt::format("unknown enum value '{}' for type '{}'", value, m_Name));
     }
   }
@@ -694,6 +901,44 @@ namespace rexsapi::xml
     context.popElement();
   }
 
+  inline void TElement::validateNode(const pugi::xml_node& node, TValidationContext& context,
+                                     TChildElements& children) const
+  {
+    m_Type->validateNode(node, context, children);
+  }
+
+  inline void TElement::compile(TElementNames& names)
+  {
+    m_Type->compile(names);
+  }
+
+  inline size_t TElementNames::registerElement(const TElement& element)
+  {
+    const auto id = registerName(element.getName());
+    m_Elements[id] = &element;
+    return id;
+  }
+
+  inline size_t TElementNames::registerName(const std::string& name)
+  {
+    const auto [it, inserted] = m_Ids.try_emplace(name, m_Elements.size());
+    if (inserted) {
+      m_Elements.emplace_back(nullptr);
+    }
+    return it->second;
+  }
+
+  inline size_t TElementNames::find(std::string_view name) const
+  {
+    const auto it = m_Ids.find(name);
+    return it == m_Ids.end() ? npos : it->second;
+  }
+
+  inline bool TElementNames::isGlobalElement(size_t id) const
+  {
+    return id < m_Elements.size() && m_Elements[id] != nullptr;
+  }
+
   [[nodiscard]] inline const TElement* TValidationContext::findElement(const std::string& name) const&
   {
     const auto it = m_Elements.find(name);
@@ -703,9 +948,19 @@ namespace rexsapi::xml
     return &it->second;
   }
 
-  inline void TValidationContext::pushElement(std::string element)
+  inline size_t TValidationContext::findElementId(std::string_view name) const
+  {
+    return m_Names ? m_Names->find(name) : TElementNames::npos;
+  }
+
+  inline bool TValidationContext::isGlobalElement(size_t id) const
+  {
+    return m_Names && m_Names->isGlobalElement(id);
+  }
+
+  inline void TValidationContext::pushElement(const std::string& element)
   {
-    m_ElementStack.emplace_back(std::move(element));
+    m_ElementStack.emplace_back(&element);
   }
 
   inline void TValidationContext::popElement()
@@ -717,8 +972,8 @@ namespace rexsapi::xml
   {
     std::stringstream stream;
     stream << "/";
-    for (const auto& s : m_ElementStack) {
-      stream << s << "/";
+    for (const auto* s : m_ElementStack) {
+      stream << *s << "/";
     }
     return stream.str();
   }
@@ -740,7 +995,7 @@ namespace rexsapi::xml
 
   inline bool TXSDSchemaValidator::validate(const pugi::xml_document& doc, std::vector<std::string>& errors) const
   {
-    TValidationContext context{m_Elements};
+    TValidationContext context{m_Elements, m_Names};
 
     for (const auto& node : doc.children()) {
       const auto* element = context.findElement(node.name());
@@ -757,6 +1012,92 @@ namespace rexsapi::xml
     return !result;
   }
 
+  inline TSchemaTraversal::TSchemaTraversal(const TXSDSchemaValidator& validator, const pugi::xml_document& doc)
+  {
+    m_Context.emplace(validator.m_Elements, validator.m_Names);
+
+    TFrame frame;
+    for (const auto& node : doc.children()) {
+      const auto* element = m_Context->findElement(node.name());
+      if (element == nullptr) {
+        m_Context->addError(fmt::format("unknown element '{}'", node.name()));
+        continue;
+      }
+      frame.m_Children.emplace_back(element, node);
+    }
+    m_Frames.emplace_back(std::move(frame));
+  }
+
+  inline void TSchemaTraversal::enter(const pugi::xml_node& node)
+  {
+    if (!m_Context || m_Frames.empty()) {
+      return;
+    }
+
+    // nodes are usually entered in document order, so the search starts after the last entered node
+    TFrame frame;
+    auto& parent = m_Frames.back();
+    const auto count = parent.m_Children.size();
+    for (size_t n = 0; n < count; ++n) {
+      const auto index = (parent.m_Next + n) % count;
+      auto& [element, child] = parent.m_Children[index];
+      if (element != nullptr && child == node) {
+        frame.m_Element = std::exchange(element, nullptr);
+        parent.m_Next = (index + 1) % count;
+        break;
+      }
+    }
+
+    // a node without element is not checked by the schema, and neither are its children
+    if (frame.m_Element) {
+      m_Context->pushElement(frame.m_Element->getName());
+      frame.m_Element->validateNode(node, *m_Context, frame.m_Children);
+    }
+    m_Frames.emplace_back(std::move(frame));
+  }
+
+  inline void TSchemaTraversal::leave()
+  {
+    if (!m_Context || m_Frames.size() < 2) {
+      return;
+    }
+
+    const auto& frame = m_Frames.back();
+    validateRemaining(frame);
+    if (frame.m_Element) {
+      m_Context->popElement();
+    }
+    m_Frames.pop_back();
+  }
+
+  inline bool TSchemaTraversal::finish(std::vector<std::string>& errors)
+  {
+    if (!m_Context) {
+      return true;
+    }
+
+    while (m_Frames.size() > 1) {
+      leave();
+    }
+    if (!m_Frames.empty()) {
+      validateRemaining(m_Frames.back());
+      m_Frames.clear();
+    }
+    bool result = m_Context->hasErrors();
+    m_Context->swap(errors);
+
+    return !result;
+  }
+
+  inline void TSchemaTraversal::validateRemaining(const TFrame& frame)
+  {
+    for (const auto& [element, child] : frame.m_Children) {
+      if (element) {
+        element->validate(child, *m_Context);
+      }
+    }
+  }
+
   inline void TXSDSchemaValidator::init()
   {
     if (const auto root = m_Doc.select_node(fmt::format("/{}:schema", xsdSchemaNS).c_str()); !root) {
@@ -795,6 +1136,13 @@ namespace rexsapi::xml
       auto element = parseElement(elements.node());
       m_Elements.try_emplace(element.getName(), std::move(element));
     }
+
+    for (const auto& [name, element] : m_Elements) {
+      (void)m_Names.registerElement(element);
+    }
+    for (auto& [name, element] : m_Elements) {
+      element.compile(m_Names);
+    }
   }
 
   inline void TXSDSchemaValidator::initTypes()
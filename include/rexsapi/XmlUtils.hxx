@@ -33,6 +33,15 @@ namespace rexsapi::xml
     return node.node().attribute(attribute).value();
   }
 
+  static inline std::string getStringAttribute(const pugi::xml_node& node, const char* attribute,
+                                               const std::string& def)
+  {
+    if (const auto att = node.attribute(attribute); !att.empty()) {
+      return att.value();
+    }
+    return def;
+  }
+
   static inline std::string getStringAttribute(const pugi::xpath_node& node, const char* attribute,
                                                const std::string& def)
   {
@@ -51,20 +60,34 @@ namespace rexsapi::xml
     return def;
   }
 
-  static inline pugi::xml_document loadXMLDocument(TResult& result, std::vector<uint8_t>& buffer,
-                                                   const xml::TXSDSchemaValidator& validator)
+  static inline pugi::xml_document loadXMLDocument(TResult& result, std::vector<uint8_t>& buffer)
   {
     pugi::xml_document doc;
     if (pugi::xml_parse_result parseResult = doc.load_buffer_inplace(buffer.data(), buffer.size()); !parseResult) {
       result.addError(TError{TErrorLevel::CRIT, parseResult.description(), parseResult.offset});
-    } else {
-      std::vector<std::string> errors;
-      if (!validator.validate(doc, errors)) {
-        for (const auto& error : errors) {
-          result.addError(TError{TErrorLevel::CRIT, error});
-        }
+    }
+
+    return doc;
+  }
+
+  static inline void validateXMLDocument(TResult& result, const pugi::xml_document& doc,
+                                         const xml::TXSDSchemaValidator& validator)
+  {
+    std::vector<std::string> errors;
+    if (!validator.validate(doc, errors)) {
+      for (const auto& error : errors) {
+        result.addError(TError{TErrorLevel::CRIT, error});
       }
     }
+  }
+
+  static inline pugi::xml_document loadXMLDocument(TResult& result, std::vector<uint8_t>& buffer,
+                                                   const xml::TXSDSchemaValidator& validator)
+  {
+    pugi::xml_document doc = loadXMLDocument(result, buffer);
+    if (result) {
+      validateXMLDocument(result, doc, validator);
+    }
 
     return doc;
   }
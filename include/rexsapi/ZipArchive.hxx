@@ -25,7 +25,10 @@
   #define MINIZ_HEADER_FILE_ONLY
 #endif
 #include <filesystem>
+#include <fstream>
+#include <limits>
 #include <miniz/miniz.h>
+#include <streambuf>
 #include <vector>
 
 namespace rexsapi
@@ -55,6 +58,47 @@ namespace rexsapi
   };
 
 
+  class ZipArchiveWriter : public std::streambuf
+  {
+  public:
+    ZipArchiveWriter(std::filesystem::path archive, std::string entry, int compressionLevel = MZ_DEFAULT_LEVEL);
+
+    ZipArchiveWriter(const ZipArchiveWriter&) = delete;
+    ZipArchiveWriter(ZipArchiveWriter&&) = delete;
+    ZipArchiveWriter& operator=(const ZipArchiveWriter&) = delete;
+    ZipArchiveWriter& operator=(ZipArchiveWriter&&) = delete;
+
+    ~ZipArchiveWriter() override;
+
+    void close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    int sync() override;
+
+  private:
+    void compress(const char* data, size_t size, tdefl_flush flush);
+    void writeLocalHeader();
+    void writeCentralDirectory();
+    void writeUInt16(uint16_t value);
+    void writeUInt32(uint32_t value);
+
+    static mz_bool putBuffer(const void* buffer, int length, void* user);
+
+    std::filesystem::path m_Archive;
+    std::string m_Entry;
+    std::ofstream m_Stream;
+    tdefl_compressor* m_Compressor{nullptr};
+    std::vector<char> m_Buffer;
+    mz_ulong m_Crc{MZ_CRC32_INIT};
+    uint64_t m_UncompressedSize{0};
+    uint64_t m_CompressedSize{0};
+    bool m_Closed{false};
+  };
+
+  static inline std::string zipEntryName(const std::filesystem::path& archive, TFileType type);
+
+
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
@@ -97,6 +141,217 @@ namespace rexsapi
     mz_free(p);
     return std::make_pair(std::move(buffer), m_Type);
   }
+
+
+  static inline std::string zipEntryName(const std::filesystem::path& archive, TFileType type)
+  {
+    auto entry = archive.filename().stem();
+    if (TExtensionChecker::getFileType(entry) != TFileType::UNKOWN) {
+      entry = entry.stem();
+    }
+    switch (type) {
+      case TFileType::XML:
+        entry += ".rexs";
+        break;
+      case TFileType::JSON:
+        entry += ".rexsj";
+        break;
+      case TFileType::BINARY:
+        entry += ".rexsb";
+        break;
+      default:
+        throw TException{fmt::format("Cannot store file type in zip archive '{}'", archive.string())};
+    }
+    return entry.string();
+  }
+
+
+  namespace detail
+  {
+    // ATTENTION: archives are written without timestamps (1980-01-01 00:00) so that storing the same model twice
+    // gives byte-identical archives
+    constexpr uint16_t ZipDosTime = 0;
+    constexpr uint16_t ZipDosDate = (1 << 5) | 1;
+    constexpr uint16_t ZipVersion = 20;
+    constexpr uint16_t ZipMethodDeflate = MZ_DEFLATED;
+    constexpr uint32_t ZipLocalHeaderSignature = 0x04034b50;
+    constexpr uint32_t ZipCentralHeaderSignature = 0x02014b50;
+    constexpr uint32_t ZipEndOfCentralDirectorySignature = 0x06054b50;
+    constexpr std::streamoff ZipLocalHeaderCrcOffset = 14;
+    constexpr size_t ZipWriteBufferSize = 64 * 1024;
+  }
+
+  inline ZipArchiveWriter::ZipArchiveWriter(std::filesystem::path archive, std::string entry, int compressionLevel)
+  : m_Archive{std::move(archive)}
+  , m_Entry{std::move(entry)}
+  {
+    if (compressionLevel < MZ_NO_COMPRESSION || compressionLevel > MZ_UBER_COMPRESSION) {
+      throw TException{fmt::format("Invalid compression level {}", compressionLevel)};
+    }
+    if (m_Entry.empty() || m_Entry.size() > std::numeric_limits<uint16_t>::max()) {
+      throw TException{fmt::format("Invalid zip entry name '{}'", m_Entry)};
+    }
+    m_Stream.open(m_Archive, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!m_Stream) {
+      throw TException{fmt::format("Cannot create zip archive '{}'", m_Archive.string())};
+    }
+    m_Compressor = tdefl_compressor_alloc();
+    if (m_Compressor == nullptr) {
+      throw TException{fmt::format("Cannot create compressor for zip archive '{}'", m_Archive.string())};
+    }
+    if (tdefl_init(m_Compressor, &ZipArchiveWriter::putBuffer, this,
+                   static_cast<int>(tdefl_create_comp_flags_from_zip_params(
+                     compressionLevel, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY))) != TDEFL_STATUS_OKAY) {
+      tdefl_compressor_free(m_Compressor);
+      throw TException{fmt::format("Cannot create compressor for zip archive '{}'", m_Archive.string())};
+    }
+    m_Buffer.resize(detail::ZipWriteBufferSize);
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    writeLocalHeader();
+  }
+
+  inline ZipArchiveWriter::~ZipArchiveWriter()
+  {
+    tdefl_compressor_free(m_Compressor);
+    if (!m_Closed) {
+      m_Stream.close();
+      std::error_code ec;
+      std::filesystem::remove(m_Archive, ec);
+    }
+  }
+
+  inline void ZipArchiveWriter::close()
+  {
+    if (m_Closed) {
+      return;
+    }
+    compress(pbase(), static_cast<size_t>(pptr() - pbase()), TDEFL_FINISH);
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    if (m_UncompressedSize > std::numeric_limits<uint32_t>::max() ||
+        m_CompressedSize > std::numeric_limits<uint32_t>::max()) {
+      throw TException{fmt::format("Zip archive '{}' exceeds 4GiB", m_Archive.string())};
+    }
+
+    const auto end = m_Stream.tellp();
+    m_Stream.seekp(detail::ZipLocalHeaderCrcOffset);
+    writeUInt32(static_cast<uint32_t>(m_Crc));
+    writeUInt32(static_cast<uint32_t>(m_CompressedSize));
+    writeUInt32(static_cast<uint32_t>(m_UncompressedSize));
+    m_Stream.seekp(end);
+    writeCentralDirectory();
+    m_Stream.close();
+    if (!m_Stream) {
+      throw TException{fmt::format("Cannot write zip archive '{}'", m_Archive.string())};
+    }
+    m_Closed = true;
+  }
+
+  inline ZipArchiveWriter::int_type ZipArchiveWriter::overflow(int_type ch)
+  {
+    try {
+      compress(pbase(), static_cast<size_t>(pptr() - pbase()), TDEFL_NO_FLUSH);
+    } catch (const TException&) {
+      return traits_type::eof();
+    }
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+    }
+    return traits_type::not_eof(ch);
+  }
+
+  inline int ZipArchiveWriter::sync()
+  {
+    // ATTENTION: deliberately not flushing the compressor here, as a sync flush would degrade the compression ratio
+    return m_Stream ? 0 : -1;
+  }
+
+  inline void ZipArchiveWriter::compress(const char* data, size_t size, tdefl_flush flush)
+  {
+    if (m_Closed) {
+      throw TException{fmt::format("Zip archive '{}' is already closed", m_Archive.string())};
+    }
+    m_Crc = mz_crc32(m_Crc, reinterpret_cast<const unsigned char*>(data), size);
+    m_UncompressedSize += size;
+    const auto status = tdefl_compress_buffer(m_Compressor, data, size, flush);
+    if ((flush == TDEFL_FINISH && status != TDEFL_STATUS_DONE) || status < TDEFL_STATUS_OKAY || !m_Stream) {
+      throw TException{fmt::format("Cannot compress into zip archive '{}'", m_Archive.string())};
+    }
+  }
+
+  inline void ZipArchiveWriter::writeLocalHeader()
+  {
+    writeUInt32(detail::ZipLocalHeaderSignature);
+    writeUInt16(detail::ZipVersion);
+    writeUInt16(0);
+    writeUInt16(detail::ZipMethodDeflate);
+    writeUInt16(detail::ZipDosTime);
+    writeUInt16(detail::ZipDosDate);
+    // crc, compressed and uncompressed size will be patched on close
+    writeUInt32(0);
+    writeUInt32(0);
+    writeUInt32(0);
+    writeUInt16(static_cast<uint16_t>(m_Entry.size()));
+    writeUInt16(0);
+    m_Stream.write(m_Entry.data(), static_cast<std::streamsize>(m_Entry.size()));
+  }
+
+  inline void ZipArchiveWriter::writeCentralDirectory()
+  {
+    const auto start = static_cast<uint64_t>(m_Stream.tellp());
+    writeUInt32(detail::ZipCentralHeaderSignature);
+    writeUInt16(detail::ZipVersion);
+    writeUInt16(detail::ZipVersion);
+    writeUInt16(0);
+    writeUInt16(detail::ZipMethodDeflate);
+    writeUInt16(detail::ZipDosTime);
+    writeUInt16(detail::ZipDosDate);
+    writeUInt32(static_cast<uint32_t>(m_Crc));
+    writeUInt32(static_cast<uint32_t>(m_CompressedSize));
+    writeUInt32(static_cast<uint32_t>(m_UncompressedSize));
+    writeUInt16(static_cast<uint16_t>(m_Entry.size()));
+    writeUInt16(0);
+    writeUInt16(0);
+    writeUInt16(0);
+    writeUInt16(0);
+    writeUInt32(0);
+    writeUInt32(0);
+    m_Stream.write(m_Entry.data(), static_cast<std::streamsize>(m_Entry.size()));
+    const auto size = static_cast<uint64_t>(m_Stream.tellp()) - start;
+    if (start > std::numeric_limits<uint32_t>::max()) {
+      throw TException{fmt::format("Zip archive '{}' exceeds 4GiB", m_Archive.string())};
+    }
+
+    writeUInt32(detail::ZipEndOfCentralDirectorySignature);
+    writeUInt16(0);
+    writeUInt16(0);
+    writeUInt16(1);
+    writeUInt16(1);
+    writeUInt32(static_cast<uint32_t>(size));
+    writeUInt32(static_cast<uint32_t>(start));
+    writeUInt16(0);
+  }
+
+  inline void ZipArchiveWriter::writeUInt16(uint16_t value)
+  {
+    const char bytes[2] = {static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF)};
+    m_Stream.write(bytes, sizeof(bytes));
+  }
+
+  inline void ZipArchiveWriter::writeUInt32(uint32_t value)
+  {
+    writeUInt16(static_cast<uint16_t>(value & 0xFFFF));
+    writeUInt16(static_cast<uint16_t>((value >> 16) & 0xFFFF));
+  }
+
+  inline mz_bool ZipArchiveWriter::putBuffer(const void* buffer, int length, void* user)
+  {
+    auto* writer = static_cast<ZipArchiveWriter*>(user);
+    writer->m_Stream.write(static_cast<const char*>(buffer), length);
+    writer->m_CompressedSize += static_cast<uint64_t>(length);
+    return writer->m_Stream.good() ? MZ_TRUE : MZ_FALSE;
+  }
 }
 
 #endif
@@ -17,8 +17,12 @@
 #ifndef REXSAPI_DATABASE_ENUM_VALUES
 #define REXSAPI_DATABASE_ENUM_VALUES
 
-#include <algorithm>
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rexsapi::database
@@ -28,18 +32,31 @@ namespace rexsapi::database
     std::string m_Name;
   };
 
+  /**
+   * @brief The allowed values of an enum attribute.
+   *
+   * The values are indexed once on construction. Each value is identified by its ordinal, the position in the
+   * database model. Ordinals can be used to switch over enum values without comparing strings.
+   */
   class TEnumValues
   {
   public:
-    explicit TEnumValues(std::vector<TEnumValue>&& values)
-    : m_Values{std::move(values)}
-    {
-    }
+    explicit TEnumValues(std::vector<TEnumValue>&& values);
 
     [[nodiscard]] bool check(const std::string& value) const;
 
+    [[nodiscard]] std::optional<size_t> getOrdinal(const std::string& value) const;
+
+    [[nodiscard]] const TEnumValue& getValue(size_t ordinal) const;
+
+    [[nodiscard]] const std::vector<TEnumValue>& getValues() const
+    {
+      return m_Values;
+    }
+
   private:
     std::vector<TEnumValue> m_Values;
+    std::unordered_map<std::string, size_t> m_Ordinals;
   };
 
 
@@ -47,13 +64,35 @@ namespace rexsapi::database
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
+  inline TEnumValues::TEnumValues(std::vector<TEnumValue>&& values)
+  : m_Values{std::move(values)}
+  {
+    m_Ordinals.reserve(m_Values.size());
+    for (size_t n = 0; n < m_Values.size(); ++n) {
+      m_Ordinals.emplace(m_Values[n].m_Value, n);
+    }
+  }
+
   inline bool TEnumValues::check(const std::string& value) const
   {
-    auto it = std::find_if(m_Values.begin(), m_Values.end(), [&value](const auto& entry) {
-      return entry.m_Value == value;
-    });
+    return m_Ordinals.find(value) != m_Ordinals.end();
+  }
 
-    return it != m_Values.end();
+  inline std::optional<size_t> TEnumValues::getOrdinal(const std::string& value) const
+  {
+    const auto it = m_Ordinals.find(value);
+    if (it == m_Ordinals.end()) {
+      return {};
+    }
+    return it->second;
+  }
+
+  inline const TEnumValue& TEnumValues::getValue(size_t ordinal) const
+  {
+    if (ordinal >= m_Values.size()) {
+      throw TException{fmt::format("enum ordinal {} does not exist", ordinal)};
+    }
+    return m_Values[ordinal];
   }
 }
 
@@ -22,22 +22,47 @@
 #include <rexsapi/Format.hxx>
 #include <rexsapi/Result.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+
 namespace rexsapi::database
 {
+  /**
+   * @brief Selects if resources are processed one after another or concurrently.
+   *
+   * In PARALLEL mode, the callback is called concurrently for different resources and has to be thread-safe.
+   */
+  enum class TLoadMode { SEQUENTIAL, PARALLEL };
+
+
+  /**
+   * @brief Loads the model database files of a directory.
+   *
+   * The callback gets the content of every resource together with the index of the resource. Resources are ordered
+   * by their path, so the index identifies a resource independent of the load mode.
+   */
   class TFileResourceLoader
   {
   public:
-    explicit TFileResourceLoader(std::filesystem::path path)
+    explicit TFileResourceLoader(std::filesystem::path path, TLoadMode loadMode = TLoadMode::SEQUENTIAL)
     : m_Path{std::move(path)}
+    , m_LoadMode{loadMode}
     {
     }
 
-    TResult load(const std::function<void(TResult&, std::vector<uint8_t>&)>& callback) const;
+    TResult load(const std::function<void(TResult&, std::vector<uint8_t>&, size_t)>& callback) const;
 
   private:
     [[nodiscard]] std::vector<std::filesystem::path> findResources(TResult& result) const;
 
+    void loadParallel(const std::vector<std::filesystem::path>& resources,
+                      const std::function<void(TResult&, std::vector<uint8_t>&, size_t)>& callback, TResult& result) const;
+
     const std::filesystem::path m_Path;
+    const TLoadMode m_LoadMode;
   };
 
 
@@ -45,7 +70,7 @@ namespace rexsapi::database
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
-  inline TResult TFileResourceLoader::load(const std::function<void(TResult&, std::vector<uint8_t>&)>& callback) const
+  inline TResult TFileResourceLoader::load(const std::function<void(TResult&, std::vector<uint8_t>&, size_t)>& callback) const
   {
     if (!callback) {
       throw TException{"callback not set for resource loader"};
@@ -54,16 +79,67 @@ namespace rexsapi::database
     TResult result;
 
     const auto resources = findResources(result);
-    std::for_each(resources.begin(), resources.end(), [&callback, &result](const auto& resource) {
-      auto buffer = loadFile(result, resource);
+    if (m_LoadMode == TLoadMode::PARALLEL && resources.size() > 1) {
+      loadParallel(resources, callback, result);
+      return result;
+    }
+
+    for (size_t n = 0; n < resources.size(); ++n) {
+      auto buffer = loadFile(result, resources[n]);
       if (buffer.size()) {
-        callback(result, buffer);
+        callback(result, buffer, n);
       }
-    });
+    }
 
     return result;
   }
 
+  inline void TFileResourceLoader::loadParallel(const std::vector<std::filesystem::path>& resources,
+                                                const std::function<void(TResult&, std::vector<uint8_t>&, size_t)>& callback,
+                                                TResult& result) const
+  {
+    // every resource gets its own result, the results are merged in resource order afterwards
+    std::vector<TResult> results(resources.size());
+    std::vector<std::exception_ptr> exceptions(resources.size());
+    std::atomic<size_t> next{0};
+
+    const auto worker = [&]() {
+      for (size_t n = next++; n < resources.size(); n = next++) {
+        try {
+          auto buffer = loadFile(results[n], resources[n]);
+          if (buffer.size()) {
+            callback(results[n], buffer, n);
+          }
+        } catch (...) {
+          exceptions[n] = std::current_exception();
+        }
+      }
+    };
+
+    const size_t count = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), resources.size());
+    std::vector<std::thread> threads;
+    try {
+      for (size_t n = 1; n < count; ++n) {
+        threads.emplace_back(worker);
+      }
+    } catch (const std::system_error&) {
+      // the remaining resources are processed by the threads already started
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (size_t n = 0; n < resources.size(); ++n) {
+      if (exceptions[n]) {
+        std::rethrow_exception(exceptions[n]);
+      }
+      for (const auto& issue : results[n].getErrors()) {
+        result.addError(issue);
+      }
+    }
+  }
+
   inline std::vector<std::filesystem::path> TFileResourceLoader::findResources(TResult& result) const
   {
     if (!std::filesystem::exists(m_Path) || !std::filesystem::is_directory(m_Path)) {
@@ -83,6 +159,8 @@ namespace rexsapi::database
     if (resources.empty()) {
       result.addError(TError{TErrorLevel::CRIT, "No model database files found"});
     }
+    // the directory iteration order is unspecified, sorting keeps the resource order deterministic
+    std::sort(resources.begin(), resources.end());
 
     return resources;
   }
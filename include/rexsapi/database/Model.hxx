@@ -25,6 +25,7 @@
 #include <rexsapi/database/Component.hxx>
 #include <rexsapi/database/Unit.hxx>
 
+#include <string_view>
 #include <unordered_map>
 
 namespace rexsapi::database
@@ -84,7 +85,7 @@ namespace rexsapi::database
 
     [[nodiscard]] const TUnit& findUnitById(uint64_t id) const;
 
-    [[nodiscard]] const TUnit& findUnitByName(const std::string& name) const;
+    [[nodiscard]] const TUnit& findUnitByName(std::string_view name) const;
 
     bool addType(uint64_t id, TValueType type);
 
@@ -104,6 +105,8 @@ namespace rexsapi::database
     std::string m_Date;
     TStatus m_Status;
     std::unordered_map<uint64_t, TUnit> m_Units;
+    // ATTENTION: the keys reference the names of the units in m_Units
+    std::unordered_map<std::string_view, const TUnit*> m_UnitsByName;
     std::unordered_map<uint64_t, TValueType> m_Types;
     std::unordered_map<std::string, TAttribute> m_Attributes;
     std::unordered_map<std::string, TComponent> m_Components;
@@ -116,7 +119,10 @@ namespace rexsapi::database
 
   inline bool TModel::addUnit(TUnit&& unit)
   {
-    const auto [_, added] = m_Units.try_emplace(unit.getId(), std::move(unit));
+    const auto [it, added] = m_Units.try_emplace(unit.getId(), std::move(unit));
+    if (added) {
+      m_UnitsByName.try_emplace(it->second.getName(), &it->second);
+    }
     return added;
   }
 
@@ -130,17 +136,14 @@ namespace rexsapi::database
     return it->second;
   }
 
-  inline const TUnit& TModel::findUnitByName(const std::string& name) const
+  inline const TUnit& TModel::findUnitByName(std::string_view name) const
   {
-    const auto it = std::find_if(m_Units.begin(), m_Units.end(), [&name](const auto& item) {
-      const auto& [_, unit] = item;
-      return unit.getName() == name;
-    });
-    if (it == m_Units.end()) {
+    const auto it = m_UnitsByName.find(name);
+    if (it == m_UnitsByName.end()) {
       throw TException{fmt::format("unit '{}' not found in database", name)};
     }
 
-    return it->second;
+    return *it->second;
   }
 
   inline bool TModel::addType(uint64_t id, TValueType type)
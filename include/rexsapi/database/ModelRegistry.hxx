@@ -31,18 +31,36 @@ namespace rexsapi::database
     TModelRegistry(TModelRegistry&&) noexcept = default;
     TModelRegistry& operator=(TModelRegistry&&) = delete;
 
-    [[nodiscard]] const TModel& getModel(const TRexsVersion& version, const std::string& language) const;
+    [[nodiscard]] const TModel& getModel(const TRexsVersion& version, std::string_view language) const;
 
     template<typename TModelLoader>
     static std::pair<TModelRegistry, TResult> createModelRegistry(const TModelLoader& loader);
 
   private:
-    explicit TModelRegistry(std::vector<TModel>&& models)
-    : m_Models{std::move(models)}
-    {
-    }
+    explicit TModelRegistry(std::vector<TModel>&& models);
+
+    struct TModelKey {
+      uint32_t m_Major;
+      uint32_t m_Minor;
+      std::string_view m_Language;
+
+      friend bool operator==(const TModelKey& lhs, const TModelKey& rhs)
+      {
+        return lhs.m_Major == rhs.m_Major && lhs.m_Minor == rhs.m_Minor && lhs.m_Language == rhs.m_Language;
+      }
+    };
+
+    struct TModelKeyHash {
+      size_t operator()(const TModelKey& key) const
+      {
+        const auto version = (static_cast<uint64_t>(key.m_Major) << 32) | key.m_Minor;
+        return std::hash<uint64_t>{}(version) ^ (std::hash<std::string_view>{}(key.m_Language) << 1);
+      }
+    };
 
     std::vector<TModel> m_Models;
+    // ATTENTION: the keys reference the languages of the models in m_Models
+    std::unordered_map<TModelKey, const TModel*, TModelKeyHash> m_Index;
   };
 
 
@@ -50,18 +68,26 @@ namespace rexsapi::database
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
-  inline const TModel& TModelRegistry::getModel(const TRexsVersion& version, const std::string& language) const
+  inline TModelRegistry::TModelRegistry(std::vector<TModel>&& models)
+  : m_Models{std::move(models)}
   {
-    const auto it = std::find_if(m_Models.begin(), m_Models.end(), [&version, &language](const auto& model) {
-      return model.getVersion() == version && model.getLanguage() == language;
-    });
+    m_Index.reserve(m_Models.size());
+    for (const auto& model : m_Models) {
+      m_Index.try_emplace(
+        TModelKey{model.getVersion().getMajor(), model.getVersion().getMinor(), model.getLanguage()}, &model);
+    }
+  }
+
+  inline const TModel& TModelRegistry::getModel(const TRexsVersion& version, std::string_view language) const
+  {
+    const auto it = m_Index.find(TModelKey{version.getMajor(), version.getMinor(), language});
 
-    if (it == m_Models.end()) {
+    if (it == m_Index.end()) {
       throw TException{
         fmt::format("cannot find a model for version '{}' and locale '{}'", version.asString(), language)};
     }
 
-    return *it;
+    return *it->second;
   }
 
   template<typename TModelLoader>
@@ -22,7 +22,13 @@
 #include <rexsapi/XmlUtils.hxx>
 #include <rexsapi/database/ComponentAttributeMapper.hxx>
 
+#include <algorithm>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
 
 namespace rexsapi::database
 {
@@ -54,8 +60,20 @@ namespace rexsapi::database
   inline TResult
   TXmlModelLoader<TResourceLoader, TSchemaLoader>::load(const std::function<void(TModel)>& callback) const
   {
-    return m_Loader.load([this, &callback](TResult& result, std::vector<uint8_t>& buffer) {
-      pugi::xml_document doc = loadXMLDocument(result, buffer, rexsapi::xml::TXSDSchemaValidator{m_SchemaLoader});
+    std::shared_ptr<const xml::TXSDSchemaValidator> validator;
+    if constexpr (std::is_same_v<TSchemaLoader, xml::TFileXsdSchemaLoader>) {
+      validator = xml::TXSDSchemaValidatorCache::get(m_SchemaLoader.getPath());
+    } else {
+      validator = std::make_shared<const xml::TXSDSchemaValidator>(m_SchemaLoader);
+    }
+
+    // ATTENTION: the resource loader may call back concurrently, so the models are stored at their resource index and
+    // passed on in a deterministic order afterwards
+    std::mutex mutex;
+    std::vector<std::optional<TModel>> models;
+    auto loadResult = m_Loader.load([this, &validator, &mutex, &models](TResult& result, std::vector<uint8_t>& buffer,
+                                                                        size_t index) {
+      pugi::xml_document doc = loadXMLDocument(result, buffer, *validator);
       if (!result) {
         return;
       }
@@ -118,8 +136,32 @@ namespace rexsapi::database
         model.addComponent(TComponent{id, name, std::move(attributes)});
       }
 
-      callback(std::move(model));
+      std::scoped_lock lock{mutex};
+      if (models.size() <= index) {
+        models.resize(index + 1);
+      }
+      models[index].emplace(std::move(model));
     });
+
+    // duplicate models are passed on in resource order
+    std::vector<size_t> order;
+    order.reserve(models.size());
+    for (size_t n = 0; n < models.size(); ++n) {
+      if (models[n]) {
+        order.emplace_back(n);
+      }
+    }
+    std::sort(order.begin(), order.end(), [&models](size_t lhs, size_t rhs) {
+      const auto& left = *models[lhs];
+      const auto& right = *models[rhs];
+      return std::tie(left.getVersion(), left.getLanguage(), left.getDate(), lhs) <
+             std::tie(right.getVersion(), right.getLanguage(), right.getDate(), rhs);
+    });
+    for (const auto n : order) {
+      callback(std::move(*models[n]));
+    }
+
+    return loadResult;
   }
 
   template<typename TResourceLoader, typename TSchemaLoader>
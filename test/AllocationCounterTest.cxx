@@ -0,0 +1,118 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define REXSAPI_ALLOCATION_COUNTER_IMPL
+#include <rexsapi/AllocationCounter.hxx>
+#include <rexsapi/ModelLoader.hxx>
+
+#include <test/TestHelper.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  class EnableCounter
+  {
+  public:
+    EnableCounter()
+    {
+      rexsapi::TAllocationCounter::enable();
+    }
+
+    ~EnableCounter()
+    {
+      rexsapi::TAllocationCounter::enable(false);
+    }
+
+    EnableCounter(const EnableCounter&) = delete;
+    EnableCounter& operator=(const EnableCounter&) = delete;
+    EnableCounter(EnableCounter&&) = delete;
+    EnableCounter& operator=(EnableCounter&&) = delete;
+  };
+}
+
+TEST_CASE("Allocation counter test")
+{
+  SUBCASE("Disabled")
+  {
+    CHECK_FALSE(rexsapi::TAllocationCounter::isEnabled());
+    rexsapi::TAllocationCounter::TScope scope;
+    rexsapi::TAllocationCounter::allocated(100);
+    const auto statistics = scope.finish();
+    CHECK(statistics.m_Allocations == 0);
+    CHECK(statistics.m_Bytes == 0);
+    CHECK(statistics.m_PeakBytes == 0);
+  }
+
+  SUBCASE("Count allocations")
+  {
+    const EnableCounter counter;
+    CHECK(rexsapi::TAllocationCounter::isEnabled());
+    rexsapi::TAllocationCounter::TScope scope;
+    rexsapi::TAllocationCounter::allocated(100);
+    rexsapi::TAllocationCounter::allocated(50);
+    rexsapi::TAllocationCounter::deallocated(100);
+    rexsapi::TAllocationCounter::deallocated(50);
+    rexsapi::TAllocationCounter::allocated(10);
+    const auto statistics = scope.finish();
+    rexsapi::TAllocationCounter::deallocated(10);
+    CHECK(statistics.m_Allocations == 3);
+    CHECK(statistics.m_Bytes == 160);
+    CHECK(statistics.m_PeakBytes == 150);
+    CHECK(scope.finish().m_Allocations == 3);
+  }
+
+  SUBCASE("Nested scopes")
+  {
+    const EnableCounter counter;
+    rexsapi::TAllocationCounter::TScope outer;
+    rexsapi::TAllocationCounter::allocated(100);
+    rexsapi::TAllocationCounter::deallocated(100);
+    rexsapi::TAllocationCounter::TScope inner;
+    rexsapi::TAllocationCounter::allocated(10);
+    const auto innerStatistics = inner.finish();
+    const auto outerStatistics = outer.finish();
+    rexsapi::TAllocationCounter::deallocated(10);
+    CHECK(innerStatistics.m_Allocations == 1);
+    CHECK(innerStatistics.m_PeakBytes == 10);
+    CHECK(outerStatistics.m_Allocations == 2);
+    CHECK(outerStatistics.m_PeakBytes == 100);
+  }
+
+  SUBCASE("Load statistics")
+  {
+    const rexsapi::TModelLoader loader{projectDir() / "models"};
+    const EnableCounter counter;
+    rexsapi::TResult result;
+    rexsapi::TLoadStatistics statistics;
+    rexsapi::TLoadOptions options;
+    options.m_Statistics = &statistics;
+    const auto model = loader.load(projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs",
+                                   result, rexsapi::TMode::STRICT_MODE, options);
+    REQUIRE(model);
+    for (const auto& phase : statistics.getPhases()) {
+      CAPTURE(rexsapi::toLoadPhaseString(phase.m_Phase));
+      if (phase.m_Phase == rexsapi::TLoadPhase::VALUE_DECODING || phase.m_Phase == rexsapi::TLoadPhase::PARSE) {
+        CHECK(phase.m_Memory.m_Allocations > 0);
+        CHECK(phase.m_Memory.m_PeakBytes > 0);
+      }
+      // the load is measured around all phases, so it includes every phase
+      CHECK(phase.m_Memory.m_Allocations <= statistics.getMemory().m_Allocations);
+      CHECK(phase.m_Memory.m_PeakBytes <= statistics.getMemory().m_PeakBytes);
+    }
+    CHECK(statistics.getMemory().m_Bytes >= statistics.getMemory().m_PeakBytes);
+  }
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/AttributeTable.hxx>
+
+#include <test/TestModel.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  rexsapi::TAttribute createWidth(rexsapi::TValueType type, rexsapi::TValue value)
+  {
+    // custom attributes can change their type between models
+    return rexsapi::TAttribute{"custom_width", rexsapi::TUnit{"mm"}, type, std::move(value)};
+  }
+
+  rexsapi::TModel createModel(const rexsapi::database::TModel& dbModel, size_t gears, bool integerWidth = false)
+  {
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{1, "shaft", "Shaft", {}});
+    for (size_t n = 0; n < gears; ++n) {
+      rexsapi::TAttributes attributes;
+      attributes.emplace_back(createAttribute(dbModel, "cylindrical_gear", "number_of_teeth",
+                                              rexsapi::TValue{static_cast<int64_t>(20 + n)}));
+      if (n % 2 == 0) {
+        attributes.emplace_back(
+          createAttribute(dbModel, "cylindrical_gear", "face_width", rexsapi::TValue{10.0 + static_cast<double>(n)}));
+      }
+      if (integerWidth) {
+        attributes.emplace_back(createWidth(rexsapi::TValueType::INTEGER, rexsapi::TValue{int64_t{10}}));
+      } else {
+        attributes.emplace_back(createWidth(rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{10.0}));
+      }
+      attributes.emplace_back(
+        createAttribute(dbModel, "cylindrical_gear", "description_datum_face", rexsapi::TValue{std::string{"left"}}));
+      components.emplace_back(rexsapi::TComponent{n + 2, "cylindrical_gear", "Gear", std::move(attributes)});
+    }
+
+    return createTestModel(std::move(components));
+  }
+}
+
+TEST_CASE("Attribute table test")
+{
+  const auto dbModel = loadModel("1.4");
+
+  SUBCASE("Extract columns")
+  {
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"face_width", "number_of_teeth", "normal_module"}};
+    table.append(createModel(dbModel, 10));
+
+    CHECK(table.getComponentType() == "cylindrical_gear");
+    REQUIRE(table.getRowCount() == 10);
+    REQUIRE(table.getColumns().size() == 3);
+    CHECK(table.getInternalIds().front() == 2);
+    CHECK(table.getInternalIds().back() == 11);
+
+    const auto& width = table.getColumn("face_width");
+    CHECK(width.getType() == rexsapi::TColumnType::FLOATING_POINT);
+    CHECK(width.getUnit() == rexsapi::TUnit{"mm"});
+    CHECK(width.size() == 10);
+    CHECK(width.getNullCount() == 5);
+    const double* widths = width.getData<double>();
+    for (size_t row = 0; row < width.size(); ++row) {
+      CAPTURE(row);
+      CHECK(width.isValid(row) == (row % 2 == 0));
+      CHECK(widths[row] == doctest::Approx(row % 2 == 0 ? 10.0 + static_cast<double>(row) : 0.0));
+    }
+    CHECK(width.getValidity()[0] == 0b01010101);
+    CHECK(width.getValidity()[1] == 0b00000001);
+    CHECK_THROWS((void)width.getData<int64_t>());
+
+    const auto& teeth = table.getColumn("number_of_teeth");
+    CHECK(teeth.getType() == rexsapi::TColumnType::INTEGER);
+    CHECK(teeth.getNullCount() == 0);
+    CHECK(teeth.getData<int64_t>()[9] == 29);
+
+    const auto& module = table.getColumn("normal_module");
+    CHECK(module.getType() == rexsapi::TColumnType::FLOATING_POINT);
+    CHECK(module.getNullCount() == 10);
+    CHECK_FALSE(module.isValid(3));
+
+    CHECK_THROWS((void)table.getColumn("description_datum_face"));
+  }
+
+  SUBCASE("Append multiple models")
+  {
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"number_of_teeth"}};
+    table.append(createModel(dbModel, 3));
+    table.append(createModel(dbModel, 0));
+    table.append(createModel(dbModel, 7));
+    CHECK(table.getRowCount() == 10);
+    CHECK(table.getModelOffsets() == std::vector<size_t>{0, 3, 3, 10});
+    const auto* teeth = table.getColumn("number_of_teeth").getData<int64_t>();
+    CHECK(teeth[2] == 22);
+    CHECK(teeth[3] == 20);
+  }
+
+  SUBCASE("Arrow layout")
+  {
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"face_width"}, rexsapi::TColumnLayout::ARROW};
+    table.append(createModel(dbModel, 3));
+    const auto& column = table.getColumns().front();
+    CHECK(reinterpret_cast<uintptr_t>(column.getData<double>()) % 64 == 0);
+    CHECK(reinterpret_cast<uintptr_t>(column.getValidity()) % 64 == 0);
+    // the padding up to 64 bytes is zeroed
+    for (size_t n = 3; n < 8; ++n) {
+      CHECK(column.getData<double>()[n] == doctest::Approx(0.0));
+    }
+    for (size_t n = 1; n < 64; ++n) {
+      CHECK(column.getValidity()[n] == 0);
+    }
+  }
+
+  SUBCASE("Unsupported types")
+  {
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"description_datum_face"}};
+    CHECK_THROWS_WITH(
+      table.append(createModel(dbModel, 2)),
+      "attribute id=description_datum_face of component id=2 has type string which cannot be stored in a column");
+    CHECK(table.getRowCount() == 0);
+  }
+
+  SUBCASE("Mismatching types keep the table unchanged")
+  {
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"number_of_teeth", "face_width", "custom_width"}};
+    table.append(createModel(dbModel, 3));
+    CHECK_THROWS(table.append(createModel(dbModel, 4, true)));
+    CHECK(table.getRowCount() == 3);
+    CHECK(table.getModelOffsets() == std::vector<size_t>{0, 3});
+    for (const auto& column : table.getColumns()) {
+      CHECK(column.size() == 3);
+    }
+    CHECK(table.getColumn("face_width").getNullCount() == 1);
+    CHECK(table.getColumn("face_width").getValidity()[0] == 0b00000101);
+
+    table.append(createModel(dbModel, 1));
+    CHECK(table.getRowCount() == 4);
+    CHECK(table.getColumn("face_width").getData<double>()[3] == doctest::Approx(10.0));
+  }
+
+  SUBCASE("Column type from first value")
+  {
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"custom_width"}};
+    table.append(createModel(dbModel, 2, true));
+    CHECK(table.getColumns().front().getType() == rexsapi::TColumnType::INTEGER);
+    CHECK(table.getColumns().front().getData<int64_t>()[1] == 10);
+    CHECK_THROWS_WITH(table.append(createModel(dbModel, 1)),
+                      "attribute id=custom_width of component id=2 has type floating_point but the column is of type "
+                      "integer");
+  }
+
+  SUBCASE("Failed first model resets the column type")
+  {
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{
+      1, "cylindrical_gear", "Gear", {createWidth(rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{10.0})}});
+    components.emplace_back(rexsapi::TComponent{
+      2, "cylindrical_gear", "Gear", {createWidth(rexsapi::TValueType::INTEGER, rexsapi::TValue{int64_t{10}})}});
+    const auto model = createTestModel(std::move(components));
+
+    rexsapi::TAttributeTable table{"cylindrical_gear", {"custom_width"}};
+    CHECK_THROWS(table.append(model));
+    CHECK(table.getColumns().front().size() == 0);
+    CHECK(table.getColumns().front().getNullCount() == 0);
+    table.append(createModel(dbModel, 2, true));
+    CHECK(table.getColumns().front().getType() == rexsapi::TColumnType::INTEGER);
+    CHECK(table.getColumns().front().getUnit() == rexsapi::TUnit{"mm"});
+  }
+}
@@ -54,4 +54,26 @@ TEST_CASE("Attribute test")
   {
     CHECK_THROWS(rexsapi::TAttribute{"", rexsapi::TUnit{"%"}, rexsapi::TValueType::STRING, rexsapi::TValue{"30"}});
   }
+
+  SUBCASE("Enum ordinals")
+  {
+    rexsapi::TAttribute attribute{dbModel.findAttributeById("type_of_gear_casing_construction_vdi_2736_2014"),
+                                  rexsapi::TUnit{dbModel.findUnitByName("none")}, rexsapi::TValue{"individual"}};
+    CHECK(attribute.getEnumOrdinal() == 2);
+    CHECK_THROWS(attribute.getEnumOrdinals());
+
+    rexsapi::TAttribute arrayAttribute{dbModel.findAttributeById("element_types"),
+                                       rexsapi::TUnit{dbModel.findUnitByName("none")},
+                                       rexsapi::TValue{rexsapi::TEnumArrayType{"line2", "hex27", "node"}}};
+    CHECK(arrayAttribute.getEnumOrdinals() == std::vector<size_t>{3, 0, 5});
+    CHECK_THROWS(arrayAttribute.getEnumOrdinal());
+
+    rexsapi::TAttribute invalidAttribute{dbModel.findAttributeById("type_of_gear_casing_construction_vdi_2736_2014"),
+                                         rexsapi::TUnit{dbModel.findUnitByName("none")}, rexsapi::TValue{"puschel"}};
+    CHECK_THROWS(invalidAttribute.getEnumOrdinal());
+
+    rexsapi::TAttribute customAttribute{"custom_enum", rexsapi::TUnit{"none"}, rexsapi::TValueType::ENUM,
+                                        rexsapi::TValue{"closed"}};
+    CHECK_THROWS(customAttribute.getEnumOrdinal());
+  }
 }
@@ -0,0 +1,281 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/BinaryModelLoader.hxx>
+#include <rexsapi/BinaryModelSerializer.hxx>
+#include <rexsapi/BinarySerializer.hxx>
+#include <rexsapi/ModelLoader.hxx>
+#include <rexsapi/ModelSaver.hxx>
+
+#include <test/TemporaryDirectory.hxx>
+#include <test/TestHelper.hxx>
+#include <test/TestModel.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  void compareAttributes(const rexsapi::TAttributes& lhs, const rexsapi::TAttributes& rhs)
+  {
+    REQUIRE(lhs.size() == rhs.size());
+    for (size_t n = 0; n < lhs.size(); ++n) {
+      CHECK(lhs[n].getAttributeId() == rhs[n].getAttributeId());
+      CHECK(lhs[n].isCustomAttribute() == rhs[n].isCustomAttribute());
+      CHECK(lhs[n].getUnit() == rhs[n].getUnit());
+      CHECK(lhs[n].getValueType() == rhs[n].getValueType());
+      CHECK(lhs[n].getValue() == rhs[n].getValue());
+      CHECK(lhs[n].getValue().coded() == rhs[n].getValue().coded());
+    }
+  }
+
+  void compareModels(const rexsapi::TModel& lhs, const rexsapi::TModel& rhs)
+  {
+    CHECK(lhs.getInfo().getApplicationId() == rhs.getInfo().getApplicationId());
+    CHECK(lhs.getInfo().getApplicationVersion() == rhs.getInfo().getApplicationVersion());
+    CHECK(lhs.getInfo().getDate() == rhs.getInfo().getDate());
+    CHECK(lhs.getInfo().getVersion() == rhs.getInfo().getVersion());
+    CHECK(lhs.getInfo().getApplicationLanguage() == rhs.getInfo().getApplicationLanguage());
+
+    REQUIRE(lhs.getComponents().size() == rhs.getComponents().size());
+    for (size_t n = 0; n < lhs.getComponents().size(); ++n) {
+      const auto& left = lhs.getComponents()[n];
+      const auto& right = rhs.getComponents()[n];
+      CHECK(left.getInternalId() == right.getInternalId());
+      CHECK(left.getType() == right.getType());
+      CHECK(left.getName() == right.getName());
+      compareAttributes(left.getAttributes(), right.getAttributes());
+    }
+
+    REQUIRE(lhs.getRelations().size() == rhs.getRelations().size());
+    for (size_t n = 0; n < lhs.getRelations().size(); ++n) {
+      const auto& left = lhs.getRelations()[n];
+      const auto& right = rhs.getRelations()[n];
+      CHECK(left.getType() == right.getType());
+      CHECK(left.getOrder() == right.getOrder());
+      REQUIRE(left.getReferences().size() == right.getReferences().size());
+      for (size_t m = 0; m < left.getReferences().size(); ++m) {
+        CHECK(left.getReferences()[m].getRole() == right.getReferences()[m].getRole());
+        CHECK(left.getReferences()[m].getHint() == right.getReferences()[m].getHint());
+        CHECK(left.getReferences()[m].getComponent().getInternalId() ==
+              right.getReferences()[m].getComponent().getInternalId());
+      }
+    }
+
+    const auto& leftSpectrum = lhs.getLoadSpectrum();
+    const auto& rightSpectrum = rhs.getLoadSpectrum();
+    REQUIRE(leftSpectrum.getLoadCases().size() == rightSpectrum.getLoadCases().size());
+    for (size_t n = 0; n < leftSpectrum.getLoadCases().size(); ++n) {
+      const auto& left = leftSpectrum.getLoadCases()[n].getLoadComponents();
+      const auto& right = rightSpectrum.getLoadCases()[n].getLoadComponents();
+      REQUIRE(left.size() == right.size());
+      for (size_t m = 0; m < left.size(); ++m) {
+        CHECK(left[m].getComponent().getInternalId() == right[m].getComponent().getInternalId());
+        compareAttributes(left[m].getLoadAttributes(), right[m].getLoadAttributes());
+        compareAttributes(left[m].getAttributes(), right[m].getAttributes());
+      }
+    }
+    REQUIRE(leftSpectrum.hasAccumulation() == rightSpectrum.hasAccumulation());
+    if (leftSpectrum.hasAccumulation()) {
+      const auto& left = leftSpectrum.getAccumulation().getLoadComponents();
+      const auto& right = rightSpectrum.getAccumulation().getLoadComponents();
+      REQUIRE(left.size() == right.size());
+      for (size_t m = 0; m < left.size(); ++m) {
+        compareAttributes(left[m].getLoadAttributes(), right[m].getLoadAttributes());
+      }
+    }
+  }
+}
+
+TEST_CASE("Binary serialize new model")
+{
+  const auto registry = createModelRegistry();
+  const auto dbModel = loadModel("1.4");
+  rexsapi::BinaryModelSerializer modelSerializer;
+  rexsapi::TBinaryModelLoader loader{rexsapi::TMode::STRICT_MODE};
+
+  SUBCASE("Serialize model to memory")
+  {
+    const auto model = createModel(dbModel);
+    rexsapi::BinaryBufferSerializer bufferSerializer;
+    modelSerializer.serialize(model, bufferSerializer);
+    REQUIRE_FALSE(bufferSerializer.getModel().empty());
+
+    rexsapi::TResult result;
+    auto roundtripModel = loader.load(result, registry, bufferSerializer.getModel());
+    CHECK(result);
+    REQUIRE(roundtripModel);
+    compareModels(model, *roundtripModel);
+  }
+
+  SUBCASE("Serialize loaded model")
+  {
+    const rexsapi::TModelLoader modelLoader{projectDir() / "models"};
+    rexsapi::TResult result;
+    const auto model = modelLoader.load(projectDir() / "test" / "example_models" / "FVA_worm_stage_1-4.rexs", result,
+                                        rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(model);
+
+    rexsapi::BinaryBufferSerializer bufferSerializer;
+    modelSerializer.serialize(*model, bufferSerializer);
+    result.reset();
+    auto roundtripModel = loader.load(result, registry, bufferSerializer.getModel());
+    CHECK(result);
+    REQUIRE(roundtripModel);
+    compareModels(*model, *roundtripModel);
+  }
+
+  SUBCASE("Serialize model to file with model saver")
+  {
+    const auto model = createModel(dbModel);
+    TemporaryDirectory guard;
+    rexsapi::TResult result;
+    rexsapi::TModelSaver{}.store(result, model, guard.getTempDirectoryPath() / "test_model", rexsapi::TSaveType::BINARY);
+    CHECK(result);
+    REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexsb"));
+
+    const rexsapi::TModelLoader modelLoader{projectDir() / "models"};
+    auto roundtripModel = modelLoader.load(guard.getTempDirectoryPath() / "test_model.rexsb", result);
+    CHECK(result);
+    REQUIRE(roundtripModel);
+    compareModels(model, *roundtripModel);
+  }
+
+  SUBCASE("Load document with invalid components and attributes")
+  {
+    const auto& couplingComponent = dbModel.findComponentById("coupling");
+    const auto& gearUnitComponent = dbModel.findComponentById("gear_unit");
+    const auto& conceptBearingComponent = dbModel.findComponentById("concept_bearing");
+
+    rexsapi::TComponents components;
+    rexsapi::TAttributes attributes;
+    attributes.emplace_back(rexsapi::TAttribute{couplingComponent.findAttributeById("mass_of_component"),
+                                                rexsapi::TUnit{dbModel.findUnitByName("kg")}, rexsapi::TValue{-3.52}});
+    attributes.emplace_back(rexsapi::TAttribute{gearUnitComponent.findAttributeById("account_for_gravity"),
+                                                rexsapi::TUnit{dbModel.findUnitByName("none")}, rexsapi::TValue{true}});
+    components.emplace_back(rexsapi::TComponent{1, "coupling", "Kupplung", std::move(attributes)});
+    attributes = rexsapi::TAttributes{};
+    attributes.emplace_back(rexsapi::TAttribute{conceptBearingComponent.findAttributeById("axial_force_absorption"),
+                                                rexsapi::TUnit{dbModel.findUnitByName("none")},
+                                                rexsapi::TValue{"sideways"}});
+    components.emplace_back(rexsapi::TComponent{2, "concept_bearing", "Lager", std::move(attributes)});
+    components.emplace_back(rexsapi::TComponent{3, "unknown_component", "Unbekannt", {}});
+
+    rexsapi::TRelations relations;
+    relations.emplace_back(rexsapi::TRelation{
+      rexsapi::TRelationType::CONNECTION,
+      {},
+      rexsapi::TRelationReferences{rexsapi::TRelationReference{rexsapi::TRelationRole::LEFT, "", components[0]},
+                                   rexsapi::TRelationReference{rexsapi::TRelationRole::RIGHT, "", components[2]}}});
+
+    const auto model = createTestModel(std::move(components), std::move(relations));
+
+    rexsapi::BinaryBufferSerializer bufferSerializer;
+    modelSerializer.serialize(model, bufferSerializer);
+
+    rexsapi::TResult result;
+    const auto roundtripModel = loader.load(result, registry, bufferSerializer.getModel());
+    REQUIRE(roundtripModel);
+    CHECK_FALSE(result);
+    CHECK_FALSE(result.isCritical());
+    REQUIRE(result.getErrors().size() == 5);
+    CHECK(result.getErrors()[0].getMessage() ==
+          "Kupplung: value is out of range for attribute id=mass_of_component of component id=1");
+    CHECK(result.getErrors()[0].isWarning());
+    CHECK(result.getErrors()[1].getMessage() ==
+          "Kupplung: attribute id=account_for_gravity is not part of component coupling id=1");
+    CHECK(result.getErrors()[2].getMessage() == "Lager: value of attribute id=axial_force_absorption of component "
+                                                "id=2 does not have the correct value type");
+    CHECK(result.getErrors()[3].getMessage() == "component id=3: component 'unknown_component' not found in database");
+    CHECK(result.getErrors()[4].getMessage() == "relation 1 referenced component 2 does not exist");
+
+    REQUIRE(roundtripModel->getComponents().size() == 2);
+    const auto& coupling = roundtripModel->getComponents()[0];
+    REQUIRE(coupling.getAttributes().size() == 2);
+    CHECK(coupling.getAttributes()[0].getValue<rexsapi::TFloatType>() == doctest::Approx(-3.52));
+    CHECK(coupling.getAttributes()[1].isCustomAttribute());
+    CHECK_FALSE(roundtripModel->getComponents()[1].getAttributes()[0].hasValue());
+    REQUIRE(roundtripModel->getRelations().size() == 1);
+    CHECK(roundtripModel->getRelations()[0].getReferences().size() == 1);
+
+    result.reset();
+    CHECK(rexsapi::TBinaryModelLoader{rexsapi::TMode::RELAXED_MODE}.load(result, registry, bufferSerializer.getModel()));
+    CHECK(result);
+    CHECK(result.getErrors().size() == 5);
+  }
+
+  SUBCASE("Load document with dangling references")
+  {
+    const auto& reference = dbModel.findComponentById("coupling").findAttributeById("reference_component_for_position");
+    const auto createReference = [&reference](int64_t id) {
+      rexsapi::TAttributes attributes;
+      attributes.emplace_back(rexsapi::TAttribute{reference, rexsapi::TUnit{reference.getUnit()}, rexsapi::TValue{id}});
+      return attributes;
+    };
+
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{1, "coupling", "Kupplung", createReference(2)});
+    components.emplace_back(rexsapi::TComponent{2, "unknown_component", "Unbekannt", {}});
+    components.emplace_back(rexsapi::TComponent{3, "coupling", "Kupplung 2", createReference(1)});
+    components.emplace_back(rexsapi::TComponent{4, "coupling", "Kupplung 3", createReference(42)});
+
+    const auto model = createTestModel(std::move(components));
+
+    rexsapi::BinaryBufferSerializer bufferSerializer;
+    modelSerializer.serialize(model, bufferSerializer);
+
+    rexsapi::TResult result;
+    const auto roundtripModel = loader.load(result, registry, bufferSerializer.getModel());
+    REQUIRE(roundtripModel);
+    CHECK_FALSE(result);
+    REQUIRE(result.getErrors().size() == 3);
+    CHECK(result.getErrors()[0].getMessage() == "component id=2: component 'unknown_component' not found in database");
+    CHECK(result.getErrors()[1].getMessage() == "referenced component id=2 does not exist");
+    CHECK(result.getErrors()[2].getMessage() == "referenced component id=42 does not exist");
+
+    REQUIRE(roundtripModel->getComponents().size() == 3);
+    CHECK(roundtripModel->getComponents()[0].getAttributes().empty());
+    CHECK(roundtripModel->getComponents()[0].findAttribute("reference_component_for_position") == nullptr);
+    REQUIRE(roundtripModel->getComponents()[1].getAttributes().size() == 1);
+    CHECK(roundtripModel->getComponents()[1].getValue<rexsapi::TReferenceComponentType>(
+            "reference_component_for_position") == 1);
+    CHECK(roundtripModel->getComponents()[2].getAttributes().empty());
+  }
+
+  SUBCASE("Load corrupt document")
+  {
+    rexsapi::BinaryBufferSerializer bufferSerializer;
+    modelSerializer.serialize(createModel(dbModel), bufferSerializer);
+
+    rexsapi::TResult result;
+    auto buffer = bufferSerializer.getModel();
+    buffer[0] = 'X';
+    CHECK_FALSE(loader.load(result, registry, buffer));
+    CHECK_FALSE(result);
+
+    result.reset();
+    buffer = bufferSerializer.getModel();
+    buffer[8] = 42;
+    CHECK_FALSE(loader.load(result, registry, buffer));
+    CHECK_FALSE(result);
+
+    result.reset();
+    buffer = bufferSerializer.getModel();
+    buffer.resize(buffer.size() / 2);
+    CHECK_FALSE(loader.load(result, registry, buffer));
+    CHECK_FALSE(result);
+  }
+}
@@ -113,6 +113,26 @@ TEST_CASE("Json serialize new model")
     REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexsj"));
   }
 
+  SUBCASE("Serialze model to compressed file with model saver")
+  {
+    TemporaryDirectory guard;
+    rexsapi::TResult result;
+    rexsapi::TModelSaver{MZ_BEST_SPEED}.store(result, createModel(dbModel),
+                                              guard.getTempDirectoryPath() / "test_model.rexs.zip",
+                                              rexsapi::TSaveType::COMPRESSED_JSON);
+    CHECK(result);
+    REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexs.zip"));
+
+    rexsapi::ZipArchive archive{guard.getTempDirectoryPath() / "test_model.rexs.zip"};
+    CHECK(archive.load().second == rexsapi::TFileType::JSON);
+
+    const rexsapi::TModelLoader loader{projectDir() / "models"};
+    auto roundtripModel = loader.load(guard.getTempDirectoryPath() / "test_model.rexs.zip", result);
+    CHECK(result);
+    REQUIRE(roundtripModel);
+    CHECK(roundtripModel->getComponents().size() == 7);
+  }
+
   SUBCASE("Serialize to non existent directory")
   {
     CHECK_THROWS(rexsapi::JsonFileSerializer{std::filesystem::path{"puschel"} / "test_model.rexsj"});
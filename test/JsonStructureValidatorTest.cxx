@@ -0,0 +1,209 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/JsonSchemaValidator.hxx>
+
+#include <test/TestHelper.hxx>
+
+#include <doctest.h>
+
+#include <fstream>
+#include <functional>
+
+namespace
+{
+  rexsapi::json loadJson(const std::filesystem::path& path)
+  {
+    std::ifstream stream{path};
+    return rexsapi::json::parse(stream);
+  }
+}
+
+TEST_CASE("Json structure validator test")
+{
+  SUBCASE("Compile rexs schema")
+  {
+    const rexsapi::TJsonStructureValidator validator{loadJson(projectDir() / "models" / "rexs-schema.json")};
+    CHECK(validator.getIgnoredKeywords() == std::vector<std::string>{"unevaluatedProperties"});
+  }
+
+  SUBCASE("Unsupported schemas")
+  {
+    CHECK_THROWS(rexsapi::TJsonStructureValidator{rexsapi::json::parse(R"({"type": "puschel"})")});
+    CHECK_THROWS(rexsapi::TJsonStructureValidator{rexsapi::json::parse(R"({"anyOf": [{"type": "string"}]})")});
+    CHECK_THROWS(rexsapi::TJsonStructureValidator{rexsapi::json::parse(R"({"$ref": "#/$defs/hutzli"})")});
+    CHECK_THROWS(rexsapi::TJsonStructureValidator{rexsapi::json::parse(R"({"pattern": "(puschel"})")});
+  }
+
+  SUBCASE("Issues")
+  {
+    const rexsapi::TJsonStructureValidator validator{rexsapi::json::parse(R"({
+      "type": "object",
+      "required": ["id", "values"],
+      "properties": {
+        "id": {"type": "integer", "minimum": 0},
+        "code": {"type": "string", "enum": ["int32", "float64"]},
+        "date": {"type": "string", "pattern": "^\\d{4}$"},
+        "values": {"type": "array", "minItems": 1, "items": {"$ref": "#/$defs/value"}}
+      },
+      "$defs": {
+        "value": {"type": ["null", "number"]}
+      }
+    })")};
+
+    std::vector<rexsapi::TJsonSchemaIssue> issues;
+    CHECK(validator.validate(rexsapi::json::parse(R"({"id": 4711, "values": [1.0, null, 3]})"), issues));
+    CHECK(issues.empty());
+
+    CHECK_FALSE(validator.validate(
+      rexsapi::json::parse(R"({"id": -1, "code": "float16", "date": "22", "values": [true]})"), issues));
+    REQUIRE(issues.size() == 9);
+    CHECK(issues[0].m_Context == "<root>[code]");
+    CHECK(issues[0].m_Description == "Failed to match against any enum values.");
+    CHECK(issues[1].m_Description == "Failed to validate against schema associated with property name 'code'.");
+    CHECK(issues[2].m_Context == "<root>[date]");
+    CHECK(issues[2].m_Description == "Failed to match regex specified by 'pattern' constraint.");
+    CHECK(issues[4].m_Context == "<root>[id]");
+    CHECK(issues[4].m_Description == "Expected number greater than or equal to 0.000000");
+    CHECK(issues[6].m_Context == "<root>[values][0]");
+    CHECK(issues[6].m_Description == "Value type not permitted by 'type' constraint.");
+    CHECK(issues[7].m_Context == "<root>[values]");
+    CHECK(issues[7].m_Description == "Failed to validate item #0 in array.");
+    CHECK(issues[8].m_Context == "<root>");
+
+    issues.clear();
+    CHECK_FALSE(validator.validate(rexsapi::json::parse(R"({"values": []})"), issues));
+    REQUIRE(issues.size() == 2);
+    CHECK(issues[0].m_Description == "Array should contain no fewer than 1 elements.");
+    CHECK(issues[1].m_Description == "Failed to validate against schema associated with property name 'values'.");
+
+    issues.clear();
+    CHECK_FALSE(validator.validate(rexsapi::json::parse(R"({"code": "int32"})"), issues));
+    REQUIRE(issues.size() == 2);
+    CHECK(issues[0].m_Description == "Missing required property 'id'.");
+    CHECK(issues[1].m_Description == "Missing required property 'values'.");
+  }
+
+  SUBCASE("One of")
+  {
+    const rexsapi::TJsonStructureValidator validator{rexsapi::json::parse(R"({
+      "type": "object",
+      "oneOf": [
+        {"properties": {"boolean": {"type": "boolean"}}, "required": ["boolean"]},
+        {"properties": {"string": {"type": "string"}}, "required": ["string"]}
+      ]
+    })")};
+
+    std::vector<rexsapi::TJsonSchemaIssue> issues;
+    CHECK(validator.validate(rexsapi::json::parse(R"({"boolean": true})"), issues));
+    CHECK(validator.validate(rexsapi::json::parse(R"({"string": "puschel"})"), issues));
+    CHECK(issues.empty());
+
+    CHECK_FALSE(validator.validate(rexsapi::json::parse(R"({"boolean": true, "string": "puschel"})"), issues));
+    REQUIRE(issues.size() == 1);
+    CHECK(issues[0].m_Description == "Failed to validate against exactly one child schema.");
+
+    issues.clear();
+    CHECK_FALSE(validator.validate(rexsapi::json::parse(R"({"boolean": "puschel"})"), issues));
+    REQUIRE(issues.size() == 6);
+    CHECK(issues[0].m_Context == "<root>[boolean]");
+    CHECK(issues[2].m_Description == "Failed to validate against child schema #0.");
+    CHECK(issues[3].m_Description == "Missing required property 'string'.");
+    CHECK(issues[4].m_Description == "Failed to validate against child schema #1.");
+    CHECK(issues[5].m_Description == "Failed to validate against any child schemas allowed by oneOf constraint.");
+  }
+}
+
+
+TEST_CASE("Json structure validator differential test")
+{
+  rexsapi::TFileJsonSchemaLoader loader{projectDir() / "models" / "rexs-schema.json"};
+  const rexsapi::TJsonSchemaValidator validator{loader};
+  REQUIRE(validator.isCompiled());
+
+  const std::vector<std::function<void(rexsapi::json&)>> mutations{
+    [](rexsapi::json&) {},
+    [](rexsapi::json& doc) {
+      doc["model"].erase("date");
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["version"] = "1.a";
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["components"] = rexsapi::json::object();
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["components"][0]["id"] = -1;
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["components"][1]["id"] = "1";
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["relations"][0]["refs"] = rexsapi::json::array();
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["relations"][1]["refs"][0].erase("role");
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["components"][0]["attributes"][0] = rexsapi::json{{"id", "puschel"}};
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["components"][0]["attributes"][0]["string"] = "hutzli";
+      doc["model"]["components"][0]["attributes"][0]["boolean"] = true;
+    },
+    [](rexsapi::json& doc) {
+      doc["model"]["components"][1]["attributes"][0] = rexsapi::json::parse(
+        R"({"id": "puschel", "floating_point_array_coded": {"code": "float16", "value": "AAAA"}})");
+    },
+  };
+
+  SUBCASE("Compiled and valijson validation agree")
+  {
+    for (const auto& file : {"FVA-Industriegetriebe_2stufig_1-4.rexsj", "FVA_worm_stage_1-4.rexsj"}) {
+      const auto model = loadJson(projectDir() / "test" / "example_models" / file);
+      for (size_t n = 0; n < mutations.size(); ++n) {
+        auto doc = model;
+        mutations[n](doc);
+
+        std::vector<std::string> compiledErrors;
+        std::vector<std::string> valijsonErrors;
+        const auto compiledResult =
+          validator.validate(doc, compiledErrors, rexsapi::TJsonValidationEngine::COMPILED);
+        const auto valijsonResult =
+          validator.validate(doc, valijsonErrors, rexsapi::TJsonValidationEngine::VALIJSON);
+        CAPTURE(file);
+        CAPTURE(n);
+        CHECK(compiledResult == (n == 0));
+        CHECK(compiledResult == valijsonResult);
+        REQUIRE(compiledErrors.size() == valijsonErrors.size());
+        for (size_t m = 0; m < compiledErrors.size(); ++m) {
+          CHECK(compiledErrors[m] == valijsonErrors[m]);
+        }
+      }
+    }
+  }
+
+  SUBCASE("Unevaluated properties are not enforced")
+  {
+    auto doc = loadJson(projectDir() / "test" / "example_models" / "FVA_worm_stage_1-4.rexsj");
+    doc["model"]["components"][0]["attributes"][0]["puschel"] = "hutzli";
+
+    std::vector<std::string> errors;
+    CHECK(validator.validate(doc, errors, rexsapi::TJsonValidationEngine::COMPILED));
+    CHECK(validator.validate(doc, errors, rexsapi::TJsonValidationEngine::VALIJSON));
+    CHECK(errors.empty());
+  }
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/LoadSpectrumMatrix.hxx>
+
+#include <doctest.h>
+
+#include <cmath>
+
+namespace
+{
+  rexsapi::TAttributes createAttributes(std::string id, rexsapi::TValueType type, rexsapi::TValue value)
+  {
+    rexsapi::TAttributes attributes;
+    attributes.emplace_back(rexsapi::TAttribute{std::move(id), rexsapi::TUnit{"none"}, type, std::move(value)});
+    return attributes;
+  }
+}
+
+TEST_CASE("Load spectrum matrix test")
+{
+  rexsapi::TComponents components;
+  components.emplace_back(rexsapi::TComponent{
+    1, "shaft", "Shaft",
+    createAttributes("mass_of_component", rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{5.0})});
+  components.emplace_back(rexsapi::TComponent{2, "cylindrical_gear", "Gear", {}});
+
+  rexsapi::TLoadCases loadCases;
+  for (size_t n = 0; n < 3; ++n) {
+    rexsapi::TLoadComponents loadComponents;
+    const auto torque = 100.0 * static_cast<double>(n + 1);
+    loadComponents.emplace_back(rexsapi::TLoadComponent{
+      components[0], createAttributes("torque", rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{torque})});
+    if (n != 1) {
+      loadComponents.emplace_back(rexsapi::TLoadComponent{
+        components[1],
+        createAttributes("number_of_load_cycles", rexsapi::TValueType::INTEGER, rexsapi::TValue{int64_t{1000}})});
+    }
+    loadCases.emplace_back(rexsapi::TLoadCase{std::move(loadComponents)});
+  }
+
+  rexsapi::TLoadComponents accumulationComponents;
+  accumulationComponents.emplace_back(rexsapi::TLoadComponent{
+    components[0], createAttributes("torque", rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{150.0})});
+
+  const rexsapi::TLoadSpectrum spectrum{std::move(loadCases),
+                                        rexsapi::TAccumulation{std::move(accumulationComponents)}};
+
+  SUBCASE("Extract matrix")
+  {
+    const rexsapi::TLoadSpectrumMatrix matrix{spectrum,
+                                              {{1, "torque"}, {2, "number_of_load_cycles"}, {1, "mass_of_component"}}};
+
+    REQUIRE(matrix.getLoadCaseCount() == 3);
+    REQUIRE(matrix.getColumnCount() == 3);
+    CHECK(matrix.getColumns()[1].m_AttributeId == "number_of_load_cycles");
+
+    CHECK(matrix(0, 0) == doctest::Approx(100.0));
+    CHECK(matrix(1, 0) == doctest::Approx(200.0));
+    CHECK(matrix(2, 0) == doctest::Approx(300.0));
+    CHECK(matrix(0, 1) == doctest::Approx(1000.0));
+    CHECK(std::isnan(matrix(1, 1)));
+    CHECK(matrix(2, 1) == doctest::Approx(1000.0));
+    CHECK(matrix(1, 2) == doctest::Approx(5.0));
+    CHECK(matrix.getMissingCount() == 1);
+
+    const double* loadCase = matrix.getLoadCase(2);
+    CHECK(loadCase[0] == doctest::Approx(300.0));
+    CHECK(loadCase == matrix.data() + 6);
+
+    REQUIRE(matrix.getAccumulation().size() == 3);
+    CHECK(matrix.getAccumulation()[0] == doctest::Approx(150.0));
+    CHECK(std::isnan(matrix.getAccumulation()[1]));
+    CHECK(matrix.getAccumulation()[2] == doctest::Approx(5.0));
+  }
+
+  SUBCASE("Missing components and attributes")
+  {
+    const rexsapi::TLoadSpectrumMatrix matrix{spectrum, {{3, "torque"}, {2, "torque"}}};
+    CHECK(matrix.getMissingCount() == 6);
+    CHECK(std::isnan(matrix(0, 0)));
+    CHECK(std::isnan(matrix(2, 1)));
+  }
+
+  SUBCASE("Duplicated load components")
+  {
+    rexsapi::TLoadComponents loadComponents;
+    loadComponents.emplace_back(rexsapi::TLoadComponent{
+      components[0], createAttributes("torque", rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{100.0})});
+    loadComponents.emplace_back(rexsapi::TLoadComponent{
+      components[0], createAttributes("torque", rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{200.0})});
+    rexsapi::TLoadCases duplicatedLoadCases;
+    duplicatedLoadCases.emplace_back(rexsapi::TLoadCase{std::move(loadComponents)});
+    const rexsapi::TLoadSpectrum duplicated{std::move(duplicatedLoadCases), {}};
+
+    const rexsapi::TLoadSpectrumMatrix matrix{duplicated, {{1, "torque"}, {1, "mass_of_component"}, {2, "torque"}}};
+    CHECK(matrix(0, 0) == doctest::Approx(100.0));
+    CHECK(matrix(0, 1) == doctest::Approx(5.0));
+    CHECK(std::isnan(matrix(0, 2)));
+    CHECK(matrix.getMissingCount() == 1);
+
+    const rexsapi::TLoadSpectrumMatrix complete{duplicated, {{1, "torque"}}};
+    CHECK(complete.getMissingCount() == 0);
+  }
+
+  SUBCASE("No accumulation")
+  {
+    const rexsapi::TLoadSpectrum empty{rexsapi::TLoadCases{}, {}};
+    const rexsapi::TLoadSpectrumMatrix matrix{empty, {{1, "torque"}}};
+    CHECK(matrix.getLoadCaseCount() == 0);
+    CHECK(matrix.getMissingCount() == 0);
+    REQUIRE(matrix.getAccumulation().size() == 1);
+    CHECK(std::isnan(matrix.getAccumulation()[0]));
+  }
+
+  SUBCASE("Unsupported types")
+  {
+    rexsapi::TComponents stringComponents;
+    stringComponents.emplace_back(rexsapi::TComponent{
+      4, "lubricant", "Lubricant", createAttributes("name", rexsapi::TValueType::STRING, rexsapi::TValue{"oil"})});
+    rexsapi::TLoadComponents loadComponents;
+    loadComponents.emplace_back(rexsapi::TLoadComponent{stringComponents[0], {}});
+    rexsapi::TLoadCases stringLoadCases;
+    stringLoadCases.emplace_back(rexsapi::TLoadCase{std::move(loadComponents)});
+    const rexsapi::TLoadSpectrum stringSpectrum{std::move(stringLoadCases), {}};
+
+    CHECK_THROWS_WITH(rexsapi::TLoadSpectrumMatrix(stringSpectrum, {{4, "name"}}),
+                      "attribute id=name of component id=4 has type string which cannot be stored in a load spectrum "
+                      "matrix");
+  }
+}
@@ -97,4 +97,32 @@ TEST_CASE("Load spectrum test")
     REQUIRE(loadSpectrum.getAccumulation().getLoadComponents().size() == 1);
     CHECK(loadSpectrum.getAccumulation().getLoadComponents()[0].getLoadAttributes().size() == 2);
   }
+
+  SUBCASE("Find attributes")
+  {
+    const auto& component = components[0];
+    REQUIRE(component.findAttribute("temperature_lubricant"));
+    CHECK(component.findAttribute("temperature_lubricant") == &component.getAttributes()[0]);
+    CHECK(component.getValue<rexsapi::TFloatType>("temperature_lubricant") == doctest::Approx{73.2});
+    CHECK(component.getValue<rexsapi::TEnumType>("type_of_gear_casing_construction_vdi_2736_2014") == "closed");
+    CHECK(component.findAttribute("mass_of_component") == nullptr);
+    CHECK_THROWS((void)component.getValue<rexsapi::TFloatType>("mass_of_component"));
+
+    rexsapi::TAttributes loadAttributes;
+    loadAttributes.emplace_back(rexsapi::TAttribute{gearCasingComponent.findAttributeById("mass_of_component"),
+                                                    rexsapi::TUnit{dbModel.findUnitByName("kg")},
+                                                    rexsapi::TValue{10.5}});
+    loadAttributes.emplace_back(rexsapi::TAttribute{gearCasingComponent.findAttributeById("temperature_lubricant"),
+                                                    rexsapi::TUnit{dbModel.findUnitByName("C")},
+                                                    rexsapi::TValue{80.0}});
+    const rexsapi::TLoadComponent loadComponent{component, std::move(loadAttributes)};
+    CHECK(loadComponent.getValue<rexsapi::TFloatType>("mass_of_component") == doctest::Approx{10.5});
+    CHECK(loadComponent.getValue<rexsapi::TFloatType>("temperature_lubricant") == doctest::Approx{80.0});
+    CHECK(loadComponent.getValue<rexsapi::TEnumType>("type_of_gear_casing_construction_vdi_2736_2014") == "closed");
+    CHECK(loadComponent.findAttribute("operating_viscosity") == nullptr);
+    CHECK_THROWS((void)loadComponent.getValue<rexsapi::TFloatType>("operating_viscosity"));
+
+    const auto copy = components;
+    CHECK(copy[0].findAttribute("temperature_lubricant") == &copy[0].getAttributes()[0]);
+  }
 }
@@ -0,0 +1,165 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/LoadStatistics.hxx>
+#include <rexsapi/ModelLoader.hxx>
+
+#include <test/TestHelper.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  const rexsapi::TLoadPhaseStatistics* findPhase(const rexsapi::TLoadStatistics& statistics, rexsapi::TLoadPhase phase)
+  {
+    for (const auto& phaseStatistics : statistics.getPhases()) {
+      if (phaseStatistics.m_Phase == phase) {
+        return &phaseStatistics;
+      }
+    }
+    return nullptr;
+  }
+}
+
+TEST_CASE("Load statistics test")
+{
+  SUBCASE("Phases are accumulated")
+  {
+    rexsapi::TLoadStatistics statistics;
+    statistics.add(rexsapi::TLoadPhase::PARSE, std::chrono::nanoseconds{100}, 1024, 0);
+    statistics.add(rexsapi::TLoadPhase::VALUE_DECODING, std::chrono::nanoseconds{50}, 0, 10);
+    statistics.add(rexsapi::TLoadPhase::PARSE, std::chrono::nanoseconds{20}, 512, 0);
+
+    REQUIRE(statistics.getPhases().size() == 2);
+    CHECK(statistics.getPhases()[0].m_Phase == rexsapi::TLoadPhase::PARSE);
+    CHECK(statistics.getPhases()[0].m_Duration == std::chrono::nanoseconds{120});
+    CHECK(statistics.getPhases()[0].m_Bytes == 1536);
+    CHECK(statistics.getPhases()[1].m_Elements == 10);
+    CHECK(statistics.getDuration() == std::chrono::nanoseconds{170});
+
+    statistics.reset();
+    CHECK(statistics.getPhases().empty());
+  }
+
+  SUBCASE("Memory of loads is accumulated")
+  {
+    rexsapi::TLoadStatistics statistics;
+    statistics.addMemory(rexsapi::TAllocationStatistics{10, 1000, 800});
+    statistics.addMemory(rexsapi::TAllocationStatistics{5, 500, 400});
+    CHECK(statistics.getMemory().m_Allocations == 15);
+    CHECK(statistics.getMemory().m_Bytes == 1500);
+    CHECK(statistics.getMemory().m_PeakBytes == 800);
+
+    statistics.reset();
+    CHECK(statistics.getMemory().m_Allocations == 0);
+    CHECK(statistics.getMemory().m_PeakBytes == 0);
+  }
+
+  SUBCASE("Scope without statistics")
+  {
+    rexsapi::TLoadStatistics::TScope scope{nullptr, rexsapi::TLoadPhase::PARSE, 42};
+    scope.elements(5);
+    scope.finish();
+  }
+
+  SUBCASE("Scope records once")
+  {
+    rexsapi::TLoadStatistics statistics;
+    {
+      rexsapi::TLoadStatistics::TScope scope{&statistics, rexsapi::TLoadPhase::RELATIONS, 42};
+      scope.elements(5);
+      scope.addElements(2);
+      scope.finish();
+    }
+    REQUIRE(statistics.getPhases().size() == 1);
+    CHECK(statistics.getPhases()[0].m_Bytes == 42);
+    CHECK(statistics.getPhases()[0].m_Elements == 7);
+  }
+
+  SUBCASE("Phase names")
+  {
+    CHECK(rexsapi::toLoadPhaseString(rexsapi::TLoadPhase::FILE_READ) == "file_read");
+    CHECK(rexsapi::toLoadPhaseString(rexsapi::TLoadPhase::SCHEMA_VALIDATION) == "schema_validation");
+    CHECK(rexsapi::toLoadPhaseString(rexsapi::TLoadPhase::LOAD_SPECTRUM) == "load_spectrum");
+  }
+}
+
+TEST_CASE("Model loader statistics test")
+{
+  const rexsapi::TModelLoader loader{projectDir() / "models"};
+  rexsapi::TResult result;
+  rexsapi::TLoadStatistics statistics;
+  rexsapi::TLoadOptions options;
+  options.m_Statistics = &statistics;
+
+  SUBCASE("Load xml model")
+  {
+    const auto path = projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs";
+    const auto model = loader.load(path, result, rexsapi::TMode::STRICT_MODE, options);
+    REQUIRE(model);
+
+    const auto* fileRead = findPhase(statistics, rexsapi::TLoadPhase::FILE_READ);
+    REQUIRE(fileRead);
+    CHECK(fileRead->m_Bytes == std::filesystem::file_size(path));
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::PARSE));
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::SCHEMA_VALIDATION)->m_Elements == 0);
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::REFERENCES)->m_Elements == model->getComponents().size());
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::RELATIONS)->m_Elements == model->getRelations().size());
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::VALUE_DECODING)->m_Elements > 0);
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::LOAD_SPECTRUM));
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::INFLATE) == nullptr);
+    // allocations are only counted if the counter is enabled
+    CHECK(statistics.getMemory().m_Allocations == 0);
+  }
+
+  SUBCASE("Load fused xml model")
+  {
+    options.m_ValidationMode = rexsapi::TValidationMode::FUSED;
+    const auto model = loader.load(projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs",
+                                   result, rexsapi::TMode::STRICT_MODE, options);
+    REQUIRE(model);
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::SCHEMA_VALIDATION));
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::RELATIONS)->m_Elements == model->getRelations().size());
+  }
+
+  SUBCASE("Load json model")
+  {
+    const auto model = loader.load(projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexsj",
+                                   result, rexsapi::TMode::STRICT_MODE, options);
+    REQUIRE(model);
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::PARSE)->m_Bytes > 0);
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::REFERENCES)->m_Elements == model->getComponents().size());
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::RELATIONS)->m_Elements == model->getRelations().size());
+  }
+
+  SUBCASE("Load compressed model")
+  {
+    const auto model = loader.load(projectDir() / "test" / "example_models" / "example_xml.rexs.zip", result,
+                                   rexsapi::TMode::STRICT_MODE, options);
+    REQUIRE(model);
+    REQUIRE(findPhase(statistics, rexsapi::TLoadPhase::INFLATE));
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::INFLATE)->m_Bytes > 0);
+    CHECK(findPhase(statistics, rexsapi::TLoadPhase::FILE_READ) == nullptr);
+  }
+
+  SUBCASE("Load without statistics")
+  {
+    const auto model =
+      loader.load(projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs", result);
+    REQUIRE(model);
+    CHECK(statistics.getPhases().empty());
+  }
+}
@@ -0,0 +1,313 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/ModelDiff.hxx>
+
+#include <test/TestModel.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  struct ModelSpec {
+    uint64_t idOffset{0};
+    double width{10.0};
+    std::string offsetUnit{"mm"};
+    bool withMass{true};
+    bool withBearing{false};
+    std::optional<uint32_t> order{};
+    bool reversed{false};
+  };
+
+  rexsapi::TModel createModel(const rexsapi::database::TModel& dbModel, const ModelSpec& spec)
+  {
+    const auto gearId = spec.idOffset + 2;
+
+    rexsapi::TAttributes shaftAttributes;
+    if (spec.withMass) {
+      shaftAttributes.emplace_back(createAttribute(dbModel, "shaft", "mass_of_component", rexsapi::TValue{5.0}));
+    }
+    shaftAttributes.emplace_back(createAttribute(dbModel, "shaft", "reference_component_for_position",
+                                                 rexsapi::TValue{static_cast<int64_t>(gearId)}));
+    rexsapi::TAttributes gearAttributes;
+    gearAttributes.emplace_back(
+      createAttribute(dbModel, "cylindrical_gear", "face_width", rexsapi::TValue{spec.width}));
+    gearAttributes.emplace_back(createAttribute(dbModel, "cylindrical_gear", "u_axis_vector",
+                                                rexsapi::TValue{std::vector<double>{1.0, spec.width / 10.0, 0.0}}));
+    // the unit of database attributes is fixed, so a unit change needs a custom attribute
+    gearAttributes.emplace_back(rexsapi::TAttribute{"custom_offset", rexsapi::TUnit{spec.offsetUnit},
+                                                    rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{1.0}});
+
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{spec.idOffset + 1, "shaft", "Shaft", std::move(shaftAttributes)});
+    components.emplace_back(rexsapi::TComponent{gearId, "cylindrical_gear", "Gear", std::move(gearAttributes)});
+    components.emplace_back(rexsapi::TComponent{spec.idOffset + 3, "cylindrical_gear", "Gear", {}});
+    if (spec.withBearing) {
+      components.emplace_back(rexsapi::TComponent{spec.idOffset + 4, "concept_bearing", "Bearing", {}});
+    }
+    if (spec.reversed) {
+      std::reverse(components.begin(), components.end());
+    }
+    const auto find = [&components](uint64_t id) -> const rexsapi::TComponent& {
+      return *std::find_if(components.begin(), components.end(), [id](const auto& component) {
+        return component.getInternalId() == id;
+      });
+    };
+
+    rexsapi::TRelations relations;
+    relations.emplace_back(rexsapi::TRelation{
+      rexsapi::TRelationType::ORDERED_ASSEMBLY, spec.order,
+      rexsapi::TRelationReferences{
+        rexsapi::TRelationReference{rexsapi::TRelationRole::PART, "part", find(gearId)},
+        rexsapi::TRelationReference{rexsapi::TRelationRole::ASSEMBLY, "assembly", find(spec.idOffset + 1)}}});
+    if (spec.withBearing) {
+      relations.emplace_back(rexsapi::TRelation{
+        rexsapi::TRelationType::SIDE, {},
+        rexsapi::TRelationReferences{
+          rexsapi::TRelationReference{rexsapi::TRelationRole::ASSEMBLY, "bearing", find(spec.idOffset + 4)},
+          rexsapi::TRelationReference{rexsapi::TRelationRole::INNER_PART, "inner_part", find(spec.idOffset + 1)}}});
+    }
+
+    return createTestModel(std::move(components), std::move(relations));
+  }
+
+  rexsapi::TModel createNamedModel(const rexsapi::database::TModel& dbModel, const std::vector<std::string>& names)
+  {
+    rexsapi::TComponents components;
+    for (size_t n = 0; n < names.size(); ++n) {
+      rexsapi::TAttributes attributes;
+      attributes.emplace_back(
+        createAttribute(dbModel, "shaft", "mass_of_component", rexsapi::TValue{static_cast<double>(n)}));
+      components.emplace_back(rexsapi::TComponent{n + 1, "shaft", names[n], std::move(attributes)});
+    }
+    return createTestModel(std::move(components));
+  }
+}
+
+TEST_CASE("Model diff test")
+{
+  const auto dbModel = loadModel("1.4");
+  const auto model = createModel(dbModel, {});
+
+  SUBCASE("Equal models")
+  {
+    const rexsapi::TModelDiff diff{model, createModel(dbModel, {})};
+    CHECK(diff.empty());
+  }
+
+  SUBCASE("Renumbered components")
+  {
+    ModelSpec spec;
+    spec.idOffset = 100;
+    const auto renumbered = createModel(dbModel, spec);
+    const rexsapi::TModelDiff diff{model, renumbered};
+    CHECK(diff.empty());
+  }
+
+  SUBCASE("Reordered components")
+  {
+    ModelSpec spec;
+    spec.reversed = true;
+    const auto reordered = createModel(dbModel, spec);
+    const rexsapi::TModelDiff diff{model, reordered};
+    // components with the same key are matched in model order, so the gears are swapped
+    REQUIRE(diff.getComponents().size() == 3);
+    CHECK(diff.getComponents()[0].m_Key == "shaft/Shaft");
+    REQUIRE(diff.getComponents()[0].m_Attributes.size() == 1);
+    CHECK(diff.getComponents()[0].m_Attributes[0].getAttributeId() == "reference_component_for_position");
+    CHECK(diff.getComponents()[1].m_Key == "cylindrical_gear/Gear");
+    CHECK(diff.getComponents()[1].m_Attributes.size() == 3);
+    CHECK(diff.getComponents()[2].m_Key == "cylindrical_gear/Gear#2");
+    CHECK(diff.getComponents()[2].m_Attributes.size() == 3);
+    REQUIRE(diff.getRelations().size() == 2);
+    CHECK(diff.getRelations()[0].m_Type == rexsapi::TDiffType::REMOVED);
+    CHECK(diff.getRelations()[1].m_Type == rexsapi::TDiffType::ADDED);
+  }
+
+  SUBCASE("Changed attributes")
+  {
+    ModelSpec spec;
+    spec.width = 10.001;
+    spec.withMass = false;
+    const auto changed = createModel(dbModel, spec);
+    const rexsapi::TModelDiff diff{model, changed};
+
+    REQUIRE(diff.getComponents().size() == 2);
+    const auto& shaft = diff.getComponents()[0];
+    CHECK(shaft.m_Type == rexsapi::TDiffType::CHANGED);
+    CHECK(shaft.m_Key == "shaft/Shaft");
+    REQUIRE(shaft.m_Attributes.size() == 1);
+    CHECK(shaft.m_Attributes[0].m_Type == rexsapi::TDiffType::REMOVED);
+    CHECK(shaft.m_Attributes[0].getAttributeId() == "mass_of_component");
+    CHECK(shaft.m_Attributes[0].m_New == nullptr);
+
+    const auto& gear = diff.getComponents()[1];
+    CHECK(gear.m_Type == rexsapi::TDiffType::CHANGED);
+    CHECK(gear.m_Key == "cylindrical_gear/Gear");
+    CHECK(gear.m_Old == &model.getComponents()[1]);
+    CHECK(gear.m_New == &changed.getComponents()[1]);
+    REQUIRE(gear.m_Attributes.size() == 2);
+    CHECK(gear.m_Attributes[0].getAttributeId() == "face_width");
+    CHECK(gear.m_Attributes[0].m_Type == rexsapi::TDiffType::CHANGED);
+    CHECK(gear.m_Attributes[1].getAttributeId() == "u_axis_vector");
+    CHECK(rexsapi::toDiffTypeString(gear.m_Attributes[1].m_Type) == "changed");
+
+    const rexsapi::TModelDiff reversed{changed, model};
+    REQUIRE(reversed.getComponents().size() == 2);
+    REQUIRE(reversed.getComponents()[0].m_Attributes.size() == 1);
+    CHECK(reversed.getComponents()[0].m_Attributes[0].m_Type == rexsapi::TDiffType::ADDED);
+    CHECK(reversed.getComponents()[0].m_Attributes[0].m_Old == nullptr);
+  }
+
+  SUBCASE("Floating point tolerance")
+  {
+    ModelSpec spec;
+    spec.width = 10.001;
+    const auto changed = createModel(dbModel, spec);
+
+    rexsapi::TModelDiffOptions options;
+    options.m_AbsoluteTolerance = 0.01;
+    CHECK(rexsapi::TModelDiff{model, changed, options}.empty());
+
+    options.m_AbsoluteTolerance = 0.0;
+    options.m_RelativeTolerance = 1e-3;
+    CHECK(rexsapi::TModelDiff{model, changed, options}.empty());
+
+    options.m_RelativeTolerance = 1e-5;
+    CHECK_FALSE(rexsapi::TModelDiff{model, changed, options}.empty());
+  }
+
+  SUBCASE("Changed unit")
+  {
+    ModelSpec spec;
+    spec.offsetUnit = "m";
+    rexsapi::TModelDiffOptions options;
+    options.m_AbsoluteTolerance = 1.0;
+    const auto changed = createModel(dbModel, spec);
+    const rexsapi::TModelDiff diff{model, changed, options};
+    REQUIRE(diff.getComponents().size() == 1);
+    REQUIRE(diff.getComponents()[0].m_Attributes.size() == 1);
+    CHECK(diff.getComponents()[0].m_Attributes[0].getAttributeId() == "custom_offset");
+  }
+
+  SUBCASE("Added and removed components and relations")
+  {
+    ModelSpec spec;
+    spec.withBearing = true;
+    const auto changed = createModel(dbModel, spec);
+    const rexsapi::TModelDiff diff{model, changed};
+
+    REQUIRE(diff.getComponents().size() == 1);
+    CHECK(diff.getComponents()[0].m_Type == rexsapi::TDiffType::ADDED);
+    CHECK(diff.getComponents()[0].m_Key == "concept_bearing/Bearing");
+    CHECK(diff.getComponents()[0].m_Old == nullptr);
+    REQUIRE(diff.getRelations().size() == 1);
+    CHECK(diff.getRelations()[0].m_Type == rexsapi::TDiffType::ADDED);
+    CHECK(diff.getRelations()[0].m_Key == "side[assembly=concept_bearing/Bearing, inner_part=shaft/Shaft]");
+
+    const rexsapi::TModelDiff reversed{changed, model};
+    REQUIRE(reversed.getComponents().size() == 1);
+    CHECK(reversed.getComponents()[0].m_Type == rexsapi::TDiffType::REMOVED);
+    REQUIRE(reversed.getRelations().size() == 1);
+    CHECK(reversed.getRelations()[0].m_Type == rexsapi::TDiffType::REMOVED);
+  }
+
+  SUBCASE("Changed relations")
+  {
+    ModelSpec spec;
+    spec.order = 1;
+    const auto changed = createModel(dbModel, spec);
+    const rexsapi::TModelDiff diff{model, changed};
+    CHECK(diff.getComponents().empty());
+    REQUIRE(diff.getRelations().size() == 1);
+    CHECK(diff.getRelations()[0].m_Type == rexsapi::TDiffType::CHANGED);
+    CHECK(diff.getRelations()[0].m_Key == "ordered_assembly[assembly=shaft/Shaft, part=cylindrical_gear/Gear]");
+    CHECK(diff.getRelations()[0].m_New->getOrder() == 1);
+  }
+
+  SUBCASE("Custom key")
+  {
+    rexsapi::TModelDiffOptions options;
+    options.m_Key = [](const rexsapi::TComponent& component) {
+      return component.getType();
+    };
+    const rexsapi::TModelDiff diff{model, createModel(dbModel, {}), options};
+    CHECK(diff.empty());
+
+    ModelSpec spec;
+    spec.idOffset = 100;
+    options.m_Key = [](const rexsapi::TComponent& component) {
+      return std::to_string(component.getInternalId());
+    };
+    const auto renumbered = createModel(dbModel, spec);
+    const rexsapi::TModelDiff byId{model, renumbered, options};
+    CHECK(byId.getComponents().size() == 6);
+    CHECK(byId.getComponents()[0].m_Key == "1");
+    CHECK(byId.getComponents()[0].m_Type == rexsapi::TDiffType::REMOVED);
+    CHECK(byId.getComponents()[3].m_Key == "101");
+    CHECK(byId.getComponents()[3].m_Type == rexsapi::TDiffType::ADDED);
+  }
+
+  SUBCASE("Copied model")
+  {
+    const rexsapi::TModel copy{model};
+    CHECK(rexsapi::TModelDiff{model, copy}.empty());
+  }
+
+  SUBCASE("Relation referencing a foreign component")
+  {
+    const rexsapi::TComponents foreign{rexsapi::TComponent{42, "shaft", "Shaft", {}}};
+    rexsapi::TRelations relations;
+    relations.emplace_back(rexsapi::TRelation{
+      rexsapi::TRelationType::REFERENCE,
+      {},
+      rexsapi::TRelationReferences{rexsapi::TRelationReference{rexsapi::TRelationRole::ORIGIN, "", foreign[0]}}});
+    const rexsapi::TModel broken{model.getInfo(), model.getComponents(), std::move(relations),
+                                 rexsapi::TLoadSpectrum{rexsapi::TLoadCases{}, {}}};
+    CHECK_THROWS_WITH((rexsapi::TModelDiff{model, broken}), "component id=42 is not part of the model");
+  }
+
+  SUBCASE("Duplicated keys do not collide with suffixed keys")
+  {
+    rexsapi::TModelDiffOptions options;
+    options.m_Key = [](const rexsapi::TComponent& component) {
+      return component.getName();
+    };
+
+    for (const auto& names : {std::vector<std::string>{"X", "X#2", "X"}, std::vector<std::string>{"X", "X", "X#2"}}) {
+      const auto oldModel = createNamedModel(dbModel, names);
+      const auto newModel = createNamedModel(dbModel, names);
+      CHECK(rexsapi::TModelDiff{oldModel, newModel, options}.empty());
+
+      auto changedNames = names;
+      changedNames.emplace_back("X");
+      const auto changed = createNamedModel(dbModel, changedNames);
+      const rexsapi::TModelDiff diff{oldModel, changed, options};
+      REQUIRE(diff.getComponents().size() == 1);
+      CHECK(diff.getComponents()[0].m_Type == rexsapi::TDiffType::ADDED);
+      CHECK(diff.getComponents()[0].m_New == &changed.getComponents()[3]);
+    }
+
+    const auto named = createNamedModel(dbModel, {"X", "X#2", "X", "X"});
+    const rexsapi::TModelDiff diff{createNamedModel(dbModel, {}), named, options};
+    REQUIRE(diff.getComponents().size() == 4);
+    CHECK(diff.getComponents()[0].m_Key == "X");
+    CHECK(diff.getComponents()[1].m_Key == "X#2");
+    CHECK(diff.getComponents()[2].m_Key == "X#3");
+    CHECK(diff.getComponents()[3].m_Key == "X#4");
+  }
+}
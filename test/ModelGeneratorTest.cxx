@@ -0,0 +1,136 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/JsonModelLoader.hxx>
+#include <rexsapi/JsonModelSerializer.hxx>
+#include <rexsapi/JsonSerializer.hxx>
+#include <rexsapi/ModelGenerator.hxx>
+#include <rexsapi/ModelLoader.hxx>
+#include <rexsapi/XMLModelSerializer.hxx>
+#include <rexsapi/XMLSerializer.hxx>
+
+#include <test/TestHelper.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  rexsapi::json toJson(const rexsapi::TModel& model)
+  {
+    rexsapi::JsonStringSerializer stringSerializer;
+    rexsapi::JsonModelSerializer modelSerializer;
+    modelSerializer.serialize(model, stringSerializer);
+    auto doc = rexsapi::json::parse(stringSerializer.getModel());
+    doc["model"].erase("date");
+    return doc;
+  }
+}
+
+TEST_CASE("Model generator test")
+{
+  const auto registry = createModelRegistry();
+  const auto& dbModel = registry.getModel({1, 4}, "en");
+
+  rexsapi::TModelGeneratorOptions options;
+  options.m_Components = 20;
+  options.m_AttributesPerComponent = 40;
+  options.m_Relations = 25;
+  options.m_ArraySize = 5;
+  options.m_MatrixSize = 3;
+  options.m_CodeType = rexsapi::TCodeType::Default;
+  options.m_LoadCases = 2;
+  options.m_Seed = 4711;
+
+  SUBCASE("Generate model")
+  {
+    const auto model = rexsapi::TModelGenerator{dbModel, options}.generate();
+    REQUIRE(model.getComponents().size() == 20);
+    for (const auto& component : model.getComponents()) {
+      CHECK(component.getAttributes().size() == 40);
+    }
+    CHECK(model.getComponents()[3].getType() == "cylindrical_gear");
+    CHECK(model.getRelations().size() == 25);
+    REQUIRE(model.getLoadSpectrum().getLoadCases().size() == 2);
+    CHECK_FALSE(model.getLoadSpectrum().getLoadCases()[0].getLoadComponents().empty());
+  }
+
+  SUBCASE("Generate model with a single component")
+  {
+    options.m_Components = 1;
+    const auto model = rexsapi::TModelGenerator{dbModel, options}.generate();
+    REQUIRE(model.getComponents().size() == 1);
+    CHECK(model.getRelations().empty());
+    REQUIRE(model.getLoadSpectrum().getLoadCases().size() == 2);
+    CHECK(&model.getLoadSpectrum().getLoadCases()[0].getLoadComponents()[0].getComponent() ==
+          &model.getComponents()[0]);
+  }
+
+  SUBCASE("Generated models are reproducible")
+  {
+    const rexsapi::TModelGenerator generator{dbModel, options};
+    CHECK(toJson(generator.generate()) == toJson(generator.generate()));
+
+    options.m_Seed = 815;
+    CHECK_FALSE(toJson(generator.generate()) == toJson(rexsapi::TModelGenerator{dbModel, options}.generate()));
+  }
+
+  SUBCASE("Generated values are the same on all platforms")
+  {
+    std::mt19937_64 engine{4711};
+    CHECK(rexsapi::detail::generateFloat(engine, 0.5, 100.0) == doctest::Approx(80.68342319040417).epsilon(1e-15));
+    CHECK(rexsapi::detail::generateFloat(engine, 0.5, 100.0) == doctest::Approx(8.9713641814352272).epsilon(1e-15));
+    CHECK(rexsapi::detail::generateFloat(engine, 0.5, 100.0) == doctest::Approx(63.946530633758826).epsilon(1e-15));
+    CHECK(rexsapi::detail::generateInt(engine, 1, 100) == 28);
+    CHECK(rexsapi::detail::generateInt(engine, 1, 100) == 96);
+    CHECK(rexsapi::detail::generateInt(engine, 1, 100) == 36);
+  }
+
+  SUBCASE("Generated models can be loaded")
+  {
+    const auto model = rexsapi::TModelGenerator{dbModel, options}.generate();
+
+    rexsapi::TFileJsonSchemaLoader jsonSchemaLoader{projectDir() / "models" / "rexs-schema.json"};
+    const rexsapi::TJsonSchemaValidator jsonValidator{jsonSchemaLoader};
+    rexsapi::JsonStringSerializer jsonSerializer;
+    rexsapi::JsonModelSerializer{}.serialize(model, jsonSerializer);
+    rexsapi::TBufferModelLoader<rexsapi::TJsonSchemaValidator, rexsapi::TJsonModelLoader> jsonLoader{
+      jsonValidator, jsonSerializer.getModel()};
+    rexsapi::TResult result;
+    const auto jsonModel = jsonLoader.load(rexsapi::TMode::STRICT_MODE, result, registry);
+    CHECK(result);
+    REQUIRE(jsonModel);
+    CHECK(jsonModel->getComponents().size() == model.getComponents().size());
+
+    rexsapi::xml::TFileXsdSchemaLoader xmlSchemaLoader{projectDir() / "models" / "rexs-schema.xsd"};
+    const rexsapi::xml::TXSDSchemaValidator xmlValidator{xmlSchemaLoader};
+    rexsapi::XMLStringSerializer xmlSerializer;
+    rexsapi::XMLModelSerializer{}.serialize(model, xmlSerializer);
+    rexsapi::TBufferModelLoader<rexsapi::xml::TXSDSchemaValidator, rexsapi::TXMLModelLoader> xmlLoader{
+      xmlValidator, xmlSerializer.getModel()};
+    result.reset();
+    const auto xmlModel = xmlLoader.load(rexsapi::TMode::STRICT_MODE, result, registry);
+    CHECK(result);
+    REQUIRE(xmlModel);
+    CHECK(xmlModel->getLoadSpectrum().getLoadCases().size() == 2);
+  }
+
+  SUBCASE("Unknown component type")
+  {
+    options.m_ComponentTypes = {"puschel"};
+    CHECK_THROWS(rexsapi::TModelGenerator{dbModel, options});
+  }
+}
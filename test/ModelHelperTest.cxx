@@ -205,4 +205,25 @@ TEST_CASE("Component post processor test")
     CHECK(processedComponents[0].getAttributes().size() == 2);
     CHECK(processedComponents[1].getAttributes().size() == 3);
   }
+
+  SUBCASE("With non exisiting reference component between attributes")
+  {
+    attributes.insert(attributes.begin() + 1,
+                      rexsapi::TAttribute{dbModel.findAttributeById("reference_component_for_position"),
+                                          rexsapi::TUnit{dbModel.findUnitByName("none")}, rexsapi::TValue{815}});
+    attributes.emplace_back(rexsapi::TAttribute{dbModel.findAttributeById("reference_component_for_position"),
+                                                rexsapi::TUnit{dbModel.findUnitByName("none")}, rexsapi::TValue{43}});
+    components.emplace_back(rexsapi::TComponent{component2Id, "lubricant", "", attributes});
+    rexsapi::ComponentPostProcessor postProcessor{result, mode, std::move(components), mapping};
+    auto processedComponents = postProcessor.release();
+
+    CHECK_FALSE(result);
+    REQUIRE(processedComponents.size() == 2);
+    const auto& processedAttributes = processedComponents[1].getAttributes();
+    REQUIRE(processedAttributes.size() == 4);
+    CHECK(processedAttributes[0].getAttributeId() == "density_at_15_degree_celsius");
+    CHECK(processedAttributes[1].getAttributeId() == "lubricant_type_iso_6336_2006");
+    CHECK(processedAttributes[2].getAttributeId() == "viscosity_at_100_degree_celsius");
+    CHECK(processedAttributes[3].getValue<rexsapi::TReferenceComponentType>() == static_cast<int64_t>(component2Id));
+  }
 }
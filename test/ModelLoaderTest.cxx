@@ -22,6 +22,52 @@
 
 #include <doctest.h>
 
+#include <thread>
+
+namespace
+{
+  void compareLazyAttributes(const rexsapi::TAttributes& eager, const rexsapi::TAttributes& lazy)
+  {
+    REQUIRE(eager.size() == lazy.size());
+    for (size_t n = 0; n < eager.size(); ++n) {
+      CHECK(eager[n].getAttributeId() == lazy[n].getAttributeId());
+      CHECK(eager[n].getValue() == lazy[n].getValue());
+      CHECK(eager[n].getValue().coded() == lazy[n].getValue().coded());
+      CHECK(lazy[n].isDecoded());
+    }
+  }
+
+  void compareLazyModels(const rexsapi::TModel& eager, const rexsapi::TModel& lazy)
+  {
+    REQUIRE(eager.getComponents().size() == lazy.getComponents().size());
+    for (size_t n = 0; n < eager.getComponents().size(); ++n) {
+      compareLazyAttributes(eager.getComponents()[n].getAttributes(), lazy.getComponents()[n].getAttributes());
+    }
+    const auto& eagerLoadCases = eager.getLoadSpectrum().getLoadCases();
+    const auto& lazyLoadCases = lazy.getLoadSpectrum().getLoadCases();
+    REQUIRE(eagerLoadCases.size() == lazyLoadCases.size());
+    for (size_t n = 0; n < eagerLoadCases.size(); ++n) {
+      REQUIRE(eagerLoadCases[n].getLoadComponents().size() == lazyLoadCases[n].getLoadComponents().size());
+      for (size_t m = 0; m < eagerLoadCases[n].getLoadComponents().size(); ++m) {
+        compareLazyAttributes(eagerLoadCases[n].getLoadComponents()[m].getLoadAttributes(),
+                              lazyLoadCases[n].getLoadComponents()[m].getLoadAttributes());
+      }
+    }
+  }
+
+  const rexsapi::TAttribute* findDeferredAttribute(const rexsapi::TModel& model)
+  {
+    for (const auto& component : model.getComponents()) {
+      for (const auto& attribute : component.getAttributes()) {
+        if (!attribute.isDecoded()) {
+          return &attribute;
+        }
+      }
+    }
+    return nullptr;
+  }
+}
+
 
 TEST_CASE("File type test")
 {
@@ -31,6 +77,7 @@ TEST_CASE("File type test")
     CHECK(rexsapi::fileTypeFromString("XML") == rexsapi::TFileType::XML);
     CHECK(rexsapi::fileTypeFromString("json") == rexsapi::TFileType::JSON);
     CHECK(rexsapi::fileTypeFromString("JSON") == rexsapi::TFileType::JSON);
+    CHECK(rexsapi::fileTypeFromString("binary") == rexsapi::TFileType::BINARY);
 
     CHECK_THROWS(rexsapi::fileTypeFromString("COMPRESSED"));
     CHECK_THROWS(rexsapi::fileTypeFromString("puschel"));
@@ -51,6 +98,8 @@ TEST_CASE("Extension checker test")
     CHECK(checker.getFileType("model_file.rexsj") == rexsapi::TFileType::JSON);
     CHECK(checker.getFileType("model_file.rexs.json") == rexsapi::TFileType::JSON);
     CHECK(checker.getFileType("model_file.some_other_text.rexs.json") == rexsapi::TFileType::JSON);
+    CHECK(checker.getFileType("model_file.rexsb") == rexsapi::TFileType::BINARY);
+    CHECK(checker.getFileType("model_file.rexs.bin") == rexsapi::TFileType::BINARY);
   }
 
   SUBCASE("Test bad extensions")
@@ -140,3 +189,63 @@ TEST_CASE("Model loader test")
     CHECK_FALSE(model);
   }
 }
+
+
+TEST_CASE("Lazy model loader test")
+{
+  const rexsapi::TModelLoader loader{projectDir() / "models"};
+  const std::vector<std::filesystem::path> files{
+    projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs",
+    projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexsj"};
+  rexsapi::TLoadOptions lazyOptions;
+  lazyOptions.m_DecodeMode = rexsapi::TDecodeMode::LAZY;
+
+  SUBCASE("Lazy values match eager values")
+  {
+    for (const auto& path : files) {
+      rexsapi::TResult eagerResult;
+      const auto eager = loader.load(path, eagerResult, rexsapi::TMode::STRICT_MODE);
+      rexsapi::TResult lazyResult;
+      const auto lazy = loader.load(path, lazyResult, rexsapi::TMode::STRICT_MODE, lazyOptions);
+      REQUIRE(eager);
+      REQUIRE(lazy);
+
+      const auto* deferred = findDeferredAttribute(*lazy);
+      REQUIRE(deferred != nullptr);
+      CHECK(deferred->hasValue());
+      CHECK(deferred->isDecoded());
+
+      rexsapi::checkValues(lazyResult, *lazy);
+      CHECK(lazyResult.getErrors().size() == eagerResult.getErrors().size());
+      compareLazyModels(*eager, *lazy);
+    }
+  }
+
+  SUBCASE("Lazy values are decoded once")
+  {
+    for (const auto& path : files) {
+      rexsapi::TResult result;
+      const auto lazy = loader.load(path, result, rexsapi::TMode::STRICT_MODE, lazyOptions);
+      REQUIRE(lazy);
+      const auto* deferred = findDeferredAttribute(*lazy);
+      REQUIRE(deferred != nullptr);
+
+      std::vector<const rexsapi::TValue*> values(4);
+      std::vector<std::thread> threads;
+      for (size_t n = 0; n < values.size(); ++n) {
+        threads.emplace_back([&values, deferred, n]() {
+          values[n] = &deferred->getValue();
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      for (const auto* value : values) {
+        CHECK(value == values[0]);
+      }
+
+      const rexsapi::TAttribute copy{*deferred};
+      CHECK(&copy.getValue() == values[0]);
+    }
+  }
+}
@@ -15,7 +15,9 @@
  */
 
 #include <rexsapi/Model.hxx>
+#include <rexsapi/ModelLoader.hxx>
 
+#include <test/TestHelper.hxx>
 #include <test/TestModelLoader.hxx>
 
 #include <doctest.h>
@@ -85,3 +87,97 @@ TEST_CASE("Model test")
     CHECK(atts[0].getValue<double>() == doctest::Approx{1.02});
   }
 }
+
+TEST_CASE("Model query test")
+{
+  const rexsapi::TModelLoader loader{projectDir() / "models"};
+  rexsapi::TResult result;
+  const auto model =
+    loader.load(projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs", result);
+  REQUIRE(model);
+
+  SUBCASE("Find components by type")
+  {
+    std::vector<const rexsapi::TComponent*> expected;
+    for (const auto& component : model->getComponents()) {
+      if (component.getType() == "cylindrical_gear") {
+        expected.emplace_back(&component);
+      }
+    }
+    const auto gears = model->findComponentsByType("cylindrical_gear");
+    REQUIRE(gears.size() == expected.size());
+    CHECK_FALSE(gears.empty());
+    size_t n = 0;
+    for (const auto& gear : gears) {
+      CHECK(&gear == expected[n]);
+      CHECK(&gears[n] == expected[n]);
+      ++n;
+    }
+    CHECK(model->findComponentsByType("puschel").empty());
+  }
+
+  SUBCASE("Find component by internal id")
+  {
+    for (const auto& component : model->getComponents()) {
+      CHECK(&model->findComponentByInternalId(component.getInternalId()) == &component);
+    }
+    CHECK_THROWS(model->findComponentByInternalId(4711));
+  }
+
+  SUBCASE("Find components with attribute")
+  {
+    const auto components = model->findComponentsWithAttribute("number_of_teeth");
+    CHECK_FALSE(components.empty());
+    for (const auto& component : components) {
+      const auto& attributes = component.getAttributes();
+      CHECK(std::find_if(attributes.begin(), attributes.end(), [](const auto& attribute) {
+              return attribute.getAttributeId() == "number_of_teeth";
+            }) != attributes.end());
+    }
+    CHECK(model->findComponentsWithAttribute("hutzli").empty());
+  }
+
+  SUBCASE("Copied model")
+  {
+    CHECK_FALSE(model->findComponentsByType("shaft").empty());
+    const rexsapi::TModel copy{*model};
+    const auto shafts = copy.findComponentsByType("shaft");
+    REQUIRE_FALSE(shafts.empty());
+    CHECK(&shafts[0] >= copy.getComponents().data());
+    CHECK(&shafts[0] < copy.getComponents().data() + copy.getComponents().size());
+
+    const auto isCopied = [&copy](const rexsapi::TComponent& component) {
+      return &copy.findComponentByInternalId(component.getInternalId()) == &component;
+    };
+    REQUIRE(copy.getRelations().size() == model->getRelations().size());
+    for (size_t n = 0; n < copy.getRelations().size(); ++n) {
+      const auto& references = copy.getRelations()[n].getReferences();
+      REQUIRE(references.size() == model->getRelations()[n].getReferences().size());
+      for (size_t m = 0; m < references.size(); ++m) {
+        CHECK(isCopied(references[m].getComponent()));
+        CHECK(references[m].getComponent().getInternalId() ==
+              model->getRelations()[n].getReferences()[m].getComponent().getInternalId());
+        CHECK(references[m].getHint() == model->getRelations()[n].getReferences()[m].getHint());
+      }
+    }
+    REQUIRE(copy.getLoadSpectrum().getLoadCases().size() == model->getLoadSpectrum().getLoadCases().size());
+    for (const auto& loadCase : copy.getLoadSpectrum().getLoadCases()) {
+      for (const auto& loadComponent : loadCase.getLoadComponents()) {
+        CHECK(isCopied(loadComponent.getComponent()));
+      }
+    }
+  }
+
+  SUBCASE("Copied model with foreign references")
+  {
+    const rexsapi::TComponents foreign{rexsapi::TComponent{1, "shaft", "Welle", {}}};
+    rexsapi::TRelations relations;
+    relations.emplace_back(rexsapi::TRelation{
+      rexsapi::TRelationType::REFERENCE,
+      {},
+      rexsapi::TRelationReferences{rexsapi::TRelationReference{rexsapi::TRelationRole::ORIGIN, "", foreign[0]}}});
+    const rexsapi::TModel broken{model->getInfo(), foreign, std::move(relations),
+                                 rexsapi::TLoadSpectrum{rexsapi::TLoadCases{}, {}}};
+    CHECK_THROWS_WITH((rexsapi::TModel{broken}), "component with internal id 1 is not part of the copied model");
+  }
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/ModelSaver.hxx>
+#include <rexsapi/ModelView.hxx>
+#include <rexsapi/database/Model.hxx>
+
+#include <test/TemporaryDirectory.hxx>
+#include <test/TestHelper.hxx>
+#include <test/TestModel.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+#include <fstream>
+
+
+TEST_CASE("Model view test")
+{
+  const auto dbModel = loadModel("1.4");
+  TemporaryDirectory guard;
+  const auto path = guard.getTempDirectoryPath() / "test_model.rexsb";
+  rexsapi::TResult result;
+  rexsapi::TModelSaver{}.store(result, createModel(dbModel), path, rexsapi::TSaveType::BINARY);
+  REQUIRE(result);
+
+  SUBCASE("Info and counts")
+  {
+    const rexsapi::TModelView view{path};
+    CHECK(view.getInfo().getApplicationId() == "REXSApi Unit Test");
+    CHECK(view.getInfo().getVersion() == rexsapi::TRexsVersion{1, 4});
+    REQUIRE(view.getInfo().getApplicationLanguage().has_value());
+    CHECK(*view.getInfo().getApplicationLanguage() == "en");
+    CHECK(view.getComponentCount() == 7);
+    CHECK(view.getRelationCount() == 3);
+    CHECK(view.getLoadCaseCount() == 1);
+    CHECK(view.hasAccumulation());
+  }
+
+  SUBCASE("Components and attributes")
+  {
+    const rexsapi::TModelView view{path};
+    const auto component = view.getComponent(1);
+    CHECK(component.getInternalId() == 2);
+    CHECK(component.getType() == "coupling");
+    CHECK(component.getName() == "Kupplung 1");
+
+    const auto attributes = component.getAttributes();
+    REQUIRE(attributes.size() == 4);
+    CHECK(attributes[0].getAttributeId() == "mass_of_component");
+    CHECK(attributes[0].getUnit() == "kg");
+    CHECK(attributes[0].getValue().getValue<rexsapi::TFloatType>() == doctest::Approx(3.52));
+
+    const auto color = attributes.find("display_color");
+    REQUIRE(color);
+    const auto array = color->getArray<double>();
+    REQUIRE(array.size() == 3);
+    CHECK(array[0] == doctest::Approx(30.0));
+    CHECK(array[2] == doctest::Approx(55.0));
+    CHECK(std::vector<double>(array.begin(), array.end()) == rexsapi::TFloatArrayType{30.0, 10.0, 55.0});
+    CHECK_THROWS(color->getArray<int64_t>());
+    CHECK_THROWS(color->getMatrix());
+    CHECK_FALSE(attributes.find("puschel"));
+
+    const auto axis = attributes.find("u_axis_vector");
+    REQUIRE(axis);
+    CHECK(axis->getCodeType() == rexsapi::TCodeType::Default);
+  }
+
+  SUBCASE("Value views")
+  {
+    const rexsapi::TModelView view{path};
+    const auto engaged = view.getComponent(2).getAttributes()[0].getArray<uint8_t>();
+    REQUIRE(engaged.size() == 2);
+    CHECK(engaged[0] == 1);
+    CHECK(engaged[1] == 0);
+
+    const auto elements = view.getComponent(4).getAttributes();
+    const auto arrays = elements.find("element_structure")->getArrays();
+    REQUIRE(arrays.size() == 3);
+    CHECK(arrays[0].size() == 3);
+    CHECK(arrays[1][1] == 5);
+    CHECK(arrays[2].at(0) == 6);
+    CHECK_THROWS(arrays[2].at(1));
+    CHECK(elements.find("element_ids")->getArray<int64_t>().size() == 3);
+
+    const auto assembly = view.getComponent(5).getAttributes();
+    CHECK(assembly.find("folder")->getString() == "./out");
+    CHECK(assembly.find("fem_file_format")->getString() == "puschel");
+    const auto matrix = assembly.find("reduced_static_stiffness_matrix")->getMatrix();
+    CHECK(matrix.getRows() == 3);
+    CHECK(matrix.getColumns() == 3);
+    CHECK(matrix(1, 2) == doctest::Approx(6.0));
+    CHECK(matrix.getRow(2)[0] == doctest::Approx(7.0));
+    CHECK(matrix.getValues().size() == 9);
+    CHECK_THROWS(matrix.getRow(3));
+  }
+
+  SUBCASE("Relations and load spectrum")
+  {
+    const rexsapi::TModelView view{path};
+    const auto relation = view.getRelation(0);
+    CHECK(relation.getType() == rexsapi::TRelationType::ASSEMBLY);
+    REQUIRE(relation.getOrder().has_value());
+    CHECK(*relation.getOrder() == 1);
+    REQUIRE(relation.getReferenceCount() == 2);
+    CHECK(relation.getReference(1).getRole() == rexsapi::TRelationRole::OUTER_PART);
+    CHECK(relation.getReference(1).getHint() == "hint1");
+    CHECK(view.getComponent(relation.getReference(1).getComponentIndex()).getInternalId() == 2);
+    CHECK_FALSE(view.getRelation(1).getOrder().has_value());
+
+    const auto loadCase = view.getLoadCase(0);
+    REQUIRE(loadCase.getLoadComponentCount() == 2);
+    CHECK(loadCase.getLoadComponent(0).getComponentIndex() == 0);
+    CHECK(loadCase.getLoadComponent(0).getLoadAttributes().size() == 2);
+    CHECK(view.getAccumulation().getLoadComponent(0).getLoadAttributes()[0].getAttributeId() == "operating_time");
+    CHECK_THROWS(view.getLoadCase(1));
+  }
+
+  SUBCASE("Views survive moving the model view")
+  {
+    rexsapi::TModelView view{path};
+    const auto array = view.getComponent(1).getAttributes()[1].getArray<double>();
+    const rexsapi::TModelView moved{std::move(view)};
+    CHECK(array[1] == doctest::Approx(10.0));
+    CHECK(moved.getComponentCount() == 7);
+  }
+
+  SUBCASE("Invalid files")
+  {
+    CHECK_THROWS(rexsapi::TModelView{guard.getTempDirectoryPath() / "non_existing.rexsb"});
+    CHECK_THROWS(rexsapi::TModelView{projectDir() / "test" / "example_models" / "FVA_worm_stage_1-4.rexs"});
+    const auto empty = guard.getTempDirectoryPath() / "empty.rexsb";
+    std::ofstream{empty}.close();
+    CHECK_THROWS(rexsapi::TModelView{empty});
+  }
+}
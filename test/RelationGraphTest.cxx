@@ -0,0 +1,133 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/RelationGraph.hxx>
+
+#include <test/TestModel.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  rexsapi::TModel createGearUnitModel()
+  {
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{1, "gear_unit", "Gear unit", {}});
+    components.emplace_back(rexsapi::TComponent{2, "shaft", "Shaft", {}});
+    components.emplace_back(rexsapi::TComponent{3, "concept_bearing", "Bearing", {}});
+    components.emplace_back(rexsapi::TComponent{4, "gear_casing", "Casing", {}});
+    components.emplace_back(rexsapi::TComponent{5, "lubricant", "Lubricant", {}});
+
+    rexsapi::TRelations relations;
+    for (const size_t n : {size_t{1}, size_t{3}, size_t{2}}) {
+      relations.emplace_back(rexsapi::TRelation{
+        rexsapi::TRelationType::ASSEMBLY,
+        {},
+        rexsapi::TRelationReferences{
+          rexsapi::TRelationReference{rexsapi::TRelationRole::ASSEMBLY, "gear_unit", components[0]},
+          rexsapi::TRelationReference{rexsapi::TRelationRole::PART, "part", components[n]}}});
+    }
+    relations.emplace_back(rexsapi::TRelation{
+      rexsapi::TRelationType::SIDE,
+      {},
+      rexsapi::TRelationReferences{
+        rexsapi::TRelationReference{rexsapi::TRelationRole::ASSEMBLY, "bearing", components[2]},
+        rexsapi::TRelationReference{rexsapi::TRelationRole::INNER_PART, "inner_part", components[1]},
+        rexsapi::TRelationReference{rexsapi::TRelationRole::OUTER_PART, "outer_part", components[3]}}});
+
+    return createTestModel(std::move(components), std::move(relations));
+  }
+
+  std::vector<uint64_t> getIds(const rexsapi::TComponentRefs& components)
+  {
+    std::vector<uint64_t> ids;
+    for (const auto& component : components) {
+      ids.emplace_back(component.get().getInternalId());
+    }
+    return ids;
+  }
+}
+
+TEST_CASE("Relation graph test")
+{
+  const auto model = createGearUnitModel();
+  const rexsapi::TRelationGraph graph{model};
+  const auto& components = model.getComponents();
+  const auto ignoreAssemblies = [](const rexsapi::TRelation& relation) {
+    return relation.getType() != rexsapi::TRelationType::ASSEMBLY;
+  };
+
+  SUBCASE("Relations of a component")
+  {
+    const auto relations = graph.getRelations(components[1]);
+    REQUIRE(relations.size() == 2);
+    CHECK(relations[0].m_Relation == &model.getRelations()[0]);
+    CHECK(relations[0].m_Reference->getRole() == rexsapi::TRelationRole::PART);
+    CHECK(relations[1].m_Relation->getType() == rexsapi::TRelationType::SIDE);
+    CHECK(relations[1].m_Reference->getRole() == rexsapi::TRelationRole::INNER_PART);
+    CHECK(graph.getRelations(components[0]).size() == 3);
+    CHECK(graph.getRelations(components[4]).empty());
+  }
+
+  SUBCASE("Neighbors")
+  {
+    CHECK(getIds(graph.getNeighbors(components[1])) == std::vector<uint64_t>{1, 3, 4});
+    CHECK(getIds(graph.getNeighbors(components[0])) == std::vector<uint64_t>{2, 3, 4});
+    CHECK(graph.getNeighbors(components[4]).empty());
+  }
+
+  SUBCASE("Neighbors by role")
+  {
+    CHECK(getIds(graph.getNeighbors(components[1], rexsapi::TRelationRole::OUTER_PART)) == std::vector<uint64_t>{4});
+    CHECK(getIds(graph.getNeighbors(components[3], rexsapi::TRelationRole::ASSEMBLY)) == std::vector<uint64_t>{1, 3});
+    CHECK(graph.getNeighbors(components[1], rexsapi::TRelationRole::GEAR).empty());
+  }
+
+  SUBCASE("Neighbors by type")
+  {
+    CHECK(getIds(graph.getNeighbors(components[1], rexsapi::TRelationType::SIDE)) == std::vector<uint64_t>{3, 4});
+    CHECK(getIds(graph.getNeighbors(components[1], rexsapi::TRelationType::ASSEMBLY)) == std::vector<uint64_t>{1});
+    CHECK(graph.getNeighbors(components[1], rexsapi::TRelationType::STAGE).empty());
+  }
+
+  SUBCASE("Subassemblies")
+  {
+    const auto all = graph.getSubassemblies();
+    REQUIRE(all.size() == 2);
+    CHECK(getIds(all[0]) == std::vector<uint64_t>{1, 2, 3, 4});
+    CHECK(getIds(all[1]) == std::vector<uint64_t>{5});
+
+    const auto withoutAssemblies = graph.getSubassemblies(ignoreAssemblies);
+    REQUIRE(withoutAssemblies.size() == 3);
+    CHECK(getIds(withoutAssemblies[0]) == std::vector<uint64_t>{1});
+    CHECK(getIds(withoutAssemblies[1]) == std::vector<uint64_t>{2, 3, 4});
+    CHECK(getIds(withoutAssemblies[2]) == std::vector<uint64_t>{5});
+  }
+
+  SUBCASE("Subassembly of a component")
+  {
+    CHECK(getIds(graph.getSubassembly(components[3])) == std::vector<uint64_t>{1, 2, 3, 4});
+    CHECK(getIds(graph.getSubassembly(components[3], ignoreAssemblies)) == std::vector<uint64_t>{2, 3, 4});
+    CHECK(getIds(graph.getSubassembly(components[4])) == std::vector<uint64_t>{5});
+  }
+
+  SUBCASE("Foreign component")
+  {
+    const rexsapi::TComponent component{6, "shaft", "Shaft", {}};
+    CHECK_THROWS((void)graph.getRelations(component));
+    CHECK_THROWS((void)graph.getNeighbors(component));
+  }
+}
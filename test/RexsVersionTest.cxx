@@ -16,8 +16,39 @@
 
 #include <rexsapi/RexsVersion.hxx>
 
+#include <optional>
+#include <random>
+#include <regex>
+
 #include <doctest.h>
 
+namespace
+{
+  std::optional<uint32_t> toNumber(std::string digits)
+  {
+    digits.erase(0, std::min(digits.find_first_not_of('0'), digits.size() - 1));
+    if (digits.size() > 10 || std::stoull(digits) > std::numeric_limits<uint32_t>::max()) {
+      return {};
+    }
+    return static_cast<uint32_t>(std::stoull(digits));
+  }
+
+  std::optional<rexsapi::TRexsVersion> parseReference(const std::string& version)
+  {
+    static const std::regex regExpr{R"(^([0-9]+)\.([0-9]+)$)"};
+    std::smatch match;
+    if (!std::regex_match(version, match, regExpr)) {
+      return {};
+    }
+    const auto major = toNumber(match[1].str());
+    const auto minor = toNumber(match[2].str());
+    if (!major || !minor) {
+      return {};
+    }
+    return rexsapi::TRexsVersion{*major, *minor};
+  }
+}
+
 TEST_CASE("Rexs version test")
 {
   SUBCASE("Create from string")
@@ -25,6 +56,7 @@ TEST_CASE("Rexs version test")
     rexsapi::TRexsVersion version{"1.4"};
     CHECK(version.getMajor() == 1);
     CHECK(version.getMinor() == 4);
+    CHECK(rexsapi::TRexsVersion{"000000000001.04"} == rexsapi::TRexsVersion{1, 4});
   }
 
   SUBCASE("Create from string fail")
@@ -32,6 +64,50 @@ TEST_CASE("Rexs version test")
     CHECK_THROWS(rexsapi::TRexsVersion{"14"});
     CHECK_THROWS(rexsapi::TRexsVersion{" 1.4"});
     CHECK_THROWS(rexsapi::TRexsVersion{"hutzli"});
+    CHECK_THROWS(rexsapi::TRexsVersion{""});
+    CHECK_THROWS(rexsapi::TRexsVersion{"."});
+    CHECK_THROWS(rexsapi::TRexsVersion{"1."});
+    CHECK_THROWS(rexsapi::TRexsVersion{".4"});
+    CHECK_THROWS(rexsapi::TRexsVersion{"1.4.1"});
+    CHECK_THROWS(rexsapi::TRexsVersion{"1.4\n"});
+    CHECK_THROWS(rexsapi::TRexsVersion{"+1.4"});
+    CHECK_THROWS(rexsapi::TRexsVersion{"1.-4"});
+    CHECK_THROWS(rexsapi::TRexsVersion{"4294967296.0"});
+    CHECK_THROWS(rexsapi::TRexsVersion{"1.99999999999999999999"});
+  }
+
+  SUBCASE("Create at compile time")
+  {
+    constexpr rexsapi::TRexsVersion version{"1.4"};
+    static_assert(version.getMajor() == 1);
+    static_assert(version.getMinor() == 4);
+    static_assert(version == rexsapi::TRexsVersion{1, 4});
+    static_assert(rexsapi::TRexsVersion{"4294967295.0"}.getMajor() == 4294967295);
+  }
+
+  SUBCASE("Fuzz parser against grammar")
+  {
+    std::mt19937 generator{4711};
+    const std::string alphabet{"0123456789.. -+x\n"};
+    std::uniform_int_distribution<size_t> length{0, 14};
+    std::uniform_int_distribution<size_t> character{0, alphabet.size() - 1};
+
+    for (size_t n = 0; n < 20000; ++n) {
+      std::string version;
+      const auto size = length(generator);
+      for (size_t m = 0; m < size; ++m) {
+        version += alphabet[character(generator)];
+      }
+
+      const auto expected = parseReference(version);
+      if (expected) {
+        REQUIRE_NOTHROW(rexsapi::TRexsVersion{version});
+        CHECK(rexsapi::TRexsVersion{version} == *expected);
+        CHECK(rexsapi::TRexsVersion{rexsapi::TRexsVersion{version}.asString()} == *expected);
+      } else {
+        REQUIRE_THROWS_AS(rexsapi::TRexsVersion{version}, rexsapi::TException);
+      }
+    }
   }
 
   SUBCASE("Create from integer")
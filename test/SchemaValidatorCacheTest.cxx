@@ -0,0 +1,90 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/JsonSchemaValidator.hxx>
+#include <rexsapi/XSDSchemaValidator.hxx>
+
+#include <test/TestHelper.hxx>
+
+#include <doctest.h>
+
+#include <fstream>
+#include <thread>
+
+namespace
+{
+  void writeFile(const std::filesystem::path& path, const std::string& content)
+  {
+    std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+    stream << content;
+  }
+}
+
+TEST_CASE("Schema validator cache test")
+{
+  SUBCASE("Validators are compiled once")
+  {
+    const auto xsd = rexsapi::xml::TXSDSchemaValidatorCache::get(projectDir() / "models" / "rexs-schema.xsd");
+    CHECK(xsd == rexsapi::xml::TXSDSchemaValidatorCache::get(projectDir() / "models" / ".." / "models" /
+                                                             "rexs-schema.xsd"));
+    CHECK(xsd != rexsapi::xml::TXSDSchemaValidatorCache::get(projectDir() / "models" / "rexs-dbmodel.xsd"));
+
+    const auto json = rexsapi::TJsonSchemaValidatorCache::get(projectDir() / "models" / "rexs-schema.json");
+    CHECK(json == rexsapi::TJsonSchemaValidatorCache::get(projectDir() / "models" / "rexs-schema.json"));
+  }
+
+  SUBCASE("Concurrent access")
+  {
+    rexsapi::TJsonSchemaValidatorCache::clear();
+    std::vector<std::shared_ptr<const rexsapi::TJsonSchemaValidator>> validators(4);
+    std::vector<std::thread> threads;
+    for (size_t n = 0; n < validators.size(); ++n) {
+      threads.emplace_back([&validators, n]() {
+        validators[n] = rexsapi::TJsonSchemaValidatorCache::get(projectDir() / "models" / "rexs-schema.json");
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const auto& validator : validators) {
+      REQUIRE(validator);
+      CHECK(validator == validators[0]);
+    }
+  }
+
+  SUBCASE("Changed schema is compiled again")
+  {
+    const auto path = std::filesystem::temp_directory_path() / "rexsapi-cache-test-schema.json";
+    writeFile(path, R"({"type": "object", "required": ["model"]})");
+    const auto first = rexsapi::TJsonSchemaValidatorCache::get(path);
+    CHECK(first == rexsapi::TJsonSchemaValidatorCache::get(path));
+
+    writeFile(path, R"({"type": "array"})");
+    const auto second = rexsapi::TJsonSchemaValidatorCache::get(path);
+    CHECK(first != second);
+
+    std::vector<std::string> errors;
+    CHECK(first->validate(rexsapi::json::parse(R"({"model": {}})"), errors));
+    CHECK_FALSE(second->validate(rexsapi::json::parse(R"({"model": {}})"), errors));
+    std::filesystem::remove(path);
+  }
+
+  SUBCASE("Missing schema")
+  {
+    CHECK_THROWS(rexsapi::TJsonSchemaValidatorCache::get(projectDir() / "models" / "non-existing-schema.json"));
+    CHECK_THROWS(rexsapi::xml::TXSDSchemaValidatorCache::get(projectDir() / "models" / "non-existing-schema.xsd"));
+  }
+}
@@ -18,8 +18,31 @@
 #define TEST_TEST_MODEL_HXX
 
 #include <rexsapi/Model.hxx>
+#include <rexsapi/database/Model.hxx>
 
 
+static inline rexsapi::TModelInfo createModelInfo()
+{
+  return rexsapi::TModelInfo{"REXSApi Unit Test", "1.0", "2022-05-20T08:59:10+01:00", rexsapi::TRexsVersion{"1.4"},
+                             "en"};
+}
+
+/// Creates an attribute of a database component with the unit of the database attribute
+static inline rexsapi::TAttribute createAttribute(const rexsapi::database::TModel& dbModel,
+                                                  const std::string& componentId, const std::string& attributeId,
+                                                  rexsapi::TValue value)
+{
+  const auto& attribute = dbModel.findComponentById(componentId).findAttributeById(attributeId);
+  return rexsapi::TAttribute{attribute, rexsapi::TUnit{attribute.getUnit()}, std::move(value)};
+}
+
+/// Creates a model without a load spectrum
+static inline rexsapi::TModel createTestModel(rexsapi::TComponents components, rexsapi::TRelations relations = {})
+{
+  return rexsapi::TModel{createModelInfo(), std::move(components), std::move(relations),
+                         rexsapi::TLoadSpectrum{rexsapi::TLoadCases{}, {}}};
+}
+
 static inline rexsapi::TModel createModel(const rexsapi::database::TModel& dbModel)
 {
   uint64_t componentId = 1;
@@ -173,9 +196,7 @@ static inline rexsapi::TModel createModel(const rexsapi::database::TModel& dbMod
 
   rexsapi::TLoadSpectrum loadSpectrum{std::move(loadCases), std::move(accumulation)};
 
-  rexsapi::TModelInfo info{"REXSApi Unit Test", "1.0", "2022-05-20T08:59:10+01:00", rexsapi::TRexsVersion{"1.4"}, "en"};
-
-  return rexsapi::TModel{info, std::move(components), std::move(relations), std::move(loadSpectrum)};
+  return rexsapi::TModel{createModelInfo(), std::move(components), std::move(relations), std::move(loadSpectrum)};
 }
 
 #endif
@@ -176,6 +176,25 @@ TEST_CASE("Value test")
     CHECK_FALSE(aofiVal == rexsapi::TValue{std::vector<int64_t>{42, 816, 4711}});
   }
 
+  SUBCASE("copies share payload")
+  {
+    const rexsapi::TValue val{std::vector<double>{42.0, 8.15, 47.11}};
+    rexsapi::TValue copy{val};
+    CHECK(copy == val);
+    CHECK(&copy.getValue<std::vector<double>>() == &val.getValue<std::vector<double>>());
+
+    copy = std::vector<double>{1.0};
+    CHECK(val.getValue<std::vector<double>>().size() == 3);
+    CHECK(copy.getValue<std::vector<double>>().size() == 1);
+    CHECK_FALSE(copy == val);
+
+    // strings are not shared, they mostly fit into the small string buffer
+    const rexsapi::TValue stringVal{"puschel"};
+    const rexsapi::TValue stringCopy{stringVal};
+    CHECK(stringCopy == stringVal);
+    CHECK(&stringCopy.getValue<std::string>() != &stringVal.getValue<std::string>());
+  }
+
   SUBCASE("Coded")
   {
     rexsapi::TValue boolVal{true};
@@ -90,6 +90,77 @@ namespace
   {
     return rexsapi::dispatch<std::string>(type, value, {});
   }
+
+  std::string visit(rexsapi::TValueType type, const rexsapi::TValue& value)
+  {
+    return rexsapi::visit<std::string>(type, value,
+                                       [](rexsapi::FloatTag, const auto& d) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "float " << d;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::BoolTag, const auto& b) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "bool " << b;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::IntTag, const auto& i) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "int " << i;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::EnumTag, const auto& s) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "enum " << s;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::StringTag, const auto& s) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "string " << s;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::FileReferenceTag, const auto& s) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "file reference " << s;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::FloatArrayTag, const auto& a) -> std::string {
+                                         return "float array " + std::to_string(a.size()) + " entries";
+                                       },
+                                       [](rexsapi::BoolArrayTag, const auto& a) -> std::string {
+                                         return "bool array " + std::to_string(a.size()) + " entries";
+                                       },
+                                       [](rexsapi::IntArrayTag, const auto& a) -> std::string {
+                                         return "int array " + std::to_string(a.size()) + " entries";
+                                       },
+                                       [](rexsapi::EnumArrayTag, const auto& a) -> std::string {
+                                         return "enum array " + std::to_string(a.size()) + " entries";
+                                       },
+                                       [](rexsapi::StringArrayTag, const auto& a) -> std::string {
+                                         return "string array " + std::to_string(a.size()) + " entries";
+                                       },
+                                       [](rexsapi::ReferenceComponentTag, const auto& n) -> std::string {
+                                         std::stringstream stream;
+                                         stream << "reference component " << n;
+                                         return stream.str();
+                                       },
+                                       [](rexsapi::FloatMatrixTag, const auto& m) -> std::string {
+                                         return "float matrix " + std::to_string(m.m_Values.size()) + " entries";
+                                       },
+                                       [](rexsapi::StringMatrixTag, const auto& m) -> std::string {
+                                         return "string matrix " + std::to_string(m.m_Values.size()) + " entries";
+                                       },
+                                       [](rexsapi::ArrayOfIntArraysTag, const auto& a) -> std::string {
+                                         return "array of int arrays " + std::to_string(a.size()) + " entries";
+                                       });
+  }
+
+  std::string visit_float(rexsapi::TValueType type, const rexsapi::TValue& value)
+  {
+    return rexsapi::visit<std::string>(type, value, [](rexsapi::FloatTag, const auto& d) -> std::string {
+      return std::to_string(d);
+    });
+  }
 }
 namespace rexsapi
 {
@@ -186,5 +257,40 @@ namespace rexsapi
       CHECK_THROWS(::dispatch_empty(rexsapi::TValueType::STRING_MATRIX, rexsapi::TValue{}));
       CHECK_THROWS(::dispatch_empty(rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS, rexsapi::TValue{}));
     }
+
+    SUBCASE("Visit type mapping")
+    {
+      const std::vector<std::pair<rexsapi::TValueType, rexsapi::TValue>> values{
+        {rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{47.11}},
+        {rexsapi::TValueType::BOOLEAN, rexsapi::TValue{true}},
+        {rexsapi::TValueType::INTEGER, rexsapi::TValue{4711}},
+        {rexsapi::TValueType::STRING, rexsapi::TValue{"puschel"}},
+        {rexsapi::TValueType::ENUM, rexsapi::TValue{"heat_treatable_steel_quenched_tempered_condition"}},
+        {rexsapi::TValueType::FILE_REFERENCE, rexsapi::TValue{"./gear.gde"}},
+        {rexsapi::TValueType::REFERENCE_COMPONENT, rexsapi::TValue{15}},
+        {rexsapi::TValueType::FLOATING_POINT_ARRAY, rexsapi::TValue{rexsapi::TFloatArrayType{1.1, 2.1, 3.1, 4.1}}},
+        {rexsapi::TValueType::BOOLEAN_ARRAY, rexsapi::TValue{rexsapi::TBoolArrayType{true, true, false, true}}},
+        {rexsapi::TValueType::INTEGER_ARRAY, rexsapi::TValue{rexsapi::TIntArrayType{1, 2, 3, 4, 5}}},
+        {rexsapi::TValueType::ENUM_ARRAY, rexsapi::TValue{rexsapi::TEnumArrayType{"1", "2", "3", "4"}}},
+        {rexsapi::TValueType::STRING_ARRAY, rexsapi::TValue{rexsapi::TStringArrayType{"a", "b", "c"}}},
+        {rexsapi::TValueType::FLOATING_POINT_MATRIX,
+         rexsapi::TValue{rexsapi::TFloatMatrixType{{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}}}}},
+        {rexsapi::TValueType::STRING_MATRIX,
+         rexsapi::TValue{rexsapi::TStringMatrixType{{{"a", "b", "c"}, {"d", "e", "f"}, {"g", "h", "i"}}}}},
+        {rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS,
+         rexsapi::TValue{rexsapi::TArrayOfIntArraysType{{1, 2, 3}, {4, 5}, {6}}}}};
+
+      for (const auto& [type, value] : values) {
+        CHECK(::visit(type, value) == ::dispatch(type, value));
+      }
+    }
+
+    SUBCASE("Visit with missing functions")
+    {
+      CHECK(::visit_float(rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{1.0}) == "1.000000");
+      CHECK_THROWS(::visit_float(rexsapi::TValueType::INTEGER, rexsapi::TValue{4711}));
+      CHECK_THROWS(::visit_float(rexsapi::TValueType::STRING_MATRIX, rexsapi::TValue{}));
+      CHECK_THROWS(::visit_float(rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{4711}));
+    }
   }
 }
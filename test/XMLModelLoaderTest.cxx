@@ -25,15 +25,27 @@
 
 namespace
 {
-  std::optional<rexsapi::TModel> loadModel(rexsapi::TResult& result, const std::filesystem::path& path,
-                                           const rexsapi::database::TModelRegistry& registry,
-                                           rexsapi::TMode mode = rexsapi::TMode::STRICT_MODE)
+  std::optional<rexsapi::TModel>
+  loadModel(rexsapi::TResult& result, const std::filesystem::path& path,
+            const rexsapi::database::TModelRegistry& registry, rexsapi::TMode mode = rexsapi::TMode::STRICT_MODE,
+            rexsapi::TValidationMode validationMode = rexsapi::TValidationMode::SEPARATE)
   {
     rexsapi::xml::TFileXsdSchemaLoader schemaLoader{projectDir() / "models" / "rexs-schema.xsd"};
     rexsapi::xml::TXSDSchemaValidator validator{schemaLoader};
 
     rexsapi::TFileModelLoader<rexsapi::xml::TXSDSchemaValidator, rexsapi::TXMLModelLoader> loader{validator, path};
-    return loader.load(mode, result, registry);
+    rexsapi::TLoadOptions options;
+    options.m_ValidationMode = validationMode;
+    return loader.load(mode, result, registry, options);
+  }
+
+  std::vector<std::string> getMessages(const rexsapi::TResult& result)
+  {
+    std::vector<std::string> messages;
+    for (const auto& error : result.getErrors()) {
+      messages.emplace_back(error.getMessage());
+    }
+    return messages;
   }
 }
 
@@ -267,3 +279,74 @@ TEST_CASE("XML Model loader test")
     REQUIRE(result.getErrors().size() == 1);
   }
 }
+
+
+TEST_CASE("XML Model loader fused validation test")
+{
+  const auto registry = createModelRegistry();
+
+  SUBCASE("Fused validation matches separate validation")
+  {
+    for (const auto* file : {"FVA_worm_stage_1-4.rexs", "FVA-Industriegetriebe_2stufig_1-4.rexs"}) {
+      const auto path = projectDir() / "test" / "example_models" / file;
+      rexsapi::TResult separateResult;
+      const auto separate = loadModel(separateResult, path, registry);
+      rexsapi::TResult fusedResult;
+      const auto fused =
+        loadModel(fusedResult, path, registry, rexsapi::TMode::STRICT_MODE, rexsapi::TValidationMode::FUSED);
+      REQUIRE(separate);
+      REQUIRE(fused);
+      CHECK(fused->getComponents().size() == separate->getComponents().size());
+      CHECK(fused->getRelations().size() == separate->getRelations().size());
+      CHECK(fused->getLoadSpectrum().getLoadCases().size() == separate->getLoadSpectrum().getLoadCases().size());
+      CHECK(getMessages(fusedResult) == getMessages(separateResult));
+    }
+  }
+
+  SUBCASE("Fused validation of invalid model")
+  {
+    std::string buffer = R"(
+      <?xml version="1.0" encoding="UTF-8" standalone="no"?>
+      <model applicationId="REXSApi Unit Test" applicationVersion="1.0" version="1.4">
+        <relations>
+          <relation id="1" type="assembly">
+            <ref hint="gear_unit" id="1" role="assembly"/>
+            <ref hint="gear_casing" id="2" role="part"/>
+          </relation>
+        </relations>
+        <components>
+          <component id="1" name="Getriebeeinheit" type="gear_unit">
+            <attribute id="account_for_gravity" unit="none">true</attribute>
+            <puschel/>
+          </component>
+          <component id="2" name="Gehäuse" type="gear_casing">
+            <attribute id="temperature_lubricant" unit="C">73.2</attribute>
+          </component>
+        </components>
+        <hutzli/>
+      </model>
+    )";
+    rexsapi::xml::TFileXsdSchemaLoader schemaLoader{projectDir() / "models" / "rexs-schema.xsd"};
+    rexsapi::xml::TXSDSchemaValidator validator{schemaLoader};
+
+    rexsapi::TResult separateResult;
+    const auto separate = rexsapi::TBufferModelLoader<rexsapi::xml::TXSDSchemaValidator, rexsapi::TXMLModelLoader>{
+      validator, buffer}.load(rexsapi::TMode::STRICT_MODE, separateResult, registry);
+    rexsapi::TResult fusedResult;
+    rexsapi::TLoadOptions options;
+    options.m_ValidationMode = rexsapi::TValidationMode::FUSED;
+    const auto fused =
+      rexsapi::TBufferModelLoader<rexsapi::xml::TXSDSchemaValidator, rexsapi::TXMLModelLoader>{validator, buffer}.load(
+        rexsapi::TMode::STRICT_MODE, fusedResult, registry, options);
+    CHECK_FALSE(separate);
+    CHECK_FALSE(fused);
+    CHECK(fusedResult.isCritical());
+
+    auto separateMessages = getMessages(separateResult);
+    auto fusedMessages = getMessages(fusedResult);
+    std::sort(separateMessages.begin(), separateMessages.end());
+    std::sort(fusedMessages.begin(), fusedMessages.end());
+    REQUIRE(fusedMessages.size() == 3);
+    CHECK(fusedMessages == separateMessages);
+  }
+}
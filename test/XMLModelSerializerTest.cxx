@@ -129,4 +129,25 @@ TEST_CASE("XML serialize new model")
     CHECK(result);
     REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexs"));
   }
+
+  SUBCASE("Serialze model to compressed file with model saver")
+  {
+    TemporaryDirectory guard;
+    rexsapi::TResult result;
+    rexsapi::TModelSaver{MZ_BEST_COMPRESSION}.store(result, createModel(dbModel),
+                                                    guard.getTempDirectoryPath() / "test_model",
+                                                    rexsapi::TSaveType::COMPRESSED_XML);
+    CHECK(result);
+    REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexsz"));
+
+    rexsapi::ZipArchive archive{guard.getTempDirectoryPath() / "test_model.rexsz"};
+    CHECK(archive.load().second == rexsapi::TFileType::XML);
+
+    const rexsapi::TModelLoader loader{projectDir() / "models"};
+    auto roundtripModel = loader.load(guard.getTempDirectoryPath() / "test_model.rexsz", result);
+    CHECK(result);
+    REQUIRE(roundtripModel);
+    CHECK(roundtripModel->getComponents().size() == 7);
+    CHECK(roundtripModel->getRelations().size() == 3);
+  }
 }
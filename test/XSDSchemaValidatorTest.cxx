@@ -263,6 +263,35 @@ TEST_CASE("XSD schema validator failure test")
     CHECK(errors[1] == "[/TestCases/Suites/Suite/] unkown element 'Püschel'");
   }
 
+  SUBCASE("Errors in document order")
+  {
+    const auto* xml = R"(
+      <?xml version="1.0" encoding="UTF-8" standalone="yes"?>
+      <TestCases version="42">
+        <Püschel />
+        <Suites>
+          <Test name="0.1" />
+          <Suite name="suite 1">
+            <Tests>
+              <Test name="1.1" />
+              <Revision>1</Revision>
+              <Test name="1.2" />
+              <Revision>2</Revision>
+            </Tests>
+          </Suite>
+        </Suites>
+        <Annotation>Hutzli</Annotation>
+      </TestCases>
+    )";
+
+    std::vector<std::string> errors;
+    CHECK_FALSE(validate(xml, errors));
+    REQUIRE(errors.size() == 3);
+    CHECK(errors[0] == "[/TestCases/] unkown element 'Püschel'");
+    CHECK(errors[1] == "[/TestCases/Suites/] element 'Test' is not allowed here");
+    CHECK(errors[2] == "[/TestCases/Suites/Suite/Tests/] too many 'Revision' elements, found 2 instead of at most 1");
+  }
+
   SUBCASE("Wrong attribute")
   {
     const auto* xml = R"(
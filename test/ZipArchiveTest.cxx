@@ -16,6 +16,7 @@
 
 #include <rexsapi/ZipArchive.hxx>
 
+#include <test/TemporaryDirectory.hxx>
 #include <test/TestHelper.hxx>
 
 #include <doctest.h>
@@ -39,4 +40,51 @@ TEST_CASE("Zip archive test")
   {
     CHECK_THROWS(rexsapi::ZipArchive{projectDir() / "test" / "example_models" / "does_not_exist.rexsz"});
   }
+
+  SUBCASE("Write and load zip")
+  {
+    TemporaryDirectory guard;
+    const auto path = guard.getTempDirectoryPath() / "model.rexsz";
+    std::string content;
+    for (int n = 0; n < 10000; ++n) {
+      content += "<component id=\"" + std::to_string(n) + "\"/>\n";
+    }
+    {
+      rexsapi::ZipArchiveWriter writer{path, rexsapi::zipEntryName(path, rexsapi::TFileType::XML)};
+      std::ostream stream{&writer};
+      stream << content;
+      writer.close();
+    }
+    CHECK(std::filesystem::file_size(path) < content.size());
+
+    rexsapi::ZipArchive archive{path};
+    auto result = archive.load();
+    CHECK(result.second == rexsapi::TFileType::XML);
+    CHECK(std::string{result.first.begin(), result.first.end()} == content);
+  }
+
+  SUBCASE("Unclosed zip is removed")
+  {
+    TemporaryDirectory guard;
+    const auto path = guard.getTempDirectoryPath() / "model.rexsz";
+    {
+      rexsapi::ZipArchiveWriter writer{path, "model.rexs"};
+      std::ostream stream{&writer};
+      stream << "<model/>";
+    }
+    CHECK_FALSE(std::filesystem::exists(path));
+  }
+
+  SUBCASE("Zip entry names")
+  {
+    CHECK(rexsapi::zipEntryName("model.rexsz", rexsapi::TFileType::XML) == "model.rexs");
+    CHECK(rexsapi::zipEntryName("/tmp/model.rexs.zip", rexsapi::TFileType::JSON) == "model.rexsj");
+    CHECK_THROWS(rexsapi::zipEntryName("model.rexsz", rexsapi::TFileType::COMPRESSED));
+  }
+
+  SUBCASE("Invalid compression level")
+  {
+    TemporaryDirectory guard;
+    CHECK_THROWS(rexsapi::ZipArchiveWriter{guard.getTempDirectoryPath() / "model.rexsz", "model.rexs", 11});
+  }
 }
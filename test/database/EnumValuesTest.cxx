@@ -42,4 +42,22 @@ TEST_CASE("Enum values test")
     CHECK_FALSE(enumValues.check("this_is_no_value"));
     CHECK_FALSE(enumValues.check(""));
   }
+
+  SUBCASE("Ordinals")
+  {
+    CHECK(enumValues.getOrdinal("both_directions") == 0);
+    CHECK(enumValues.getOrdinal("positive") == 3);
+    CHECK_FALSE(enumValues.getOrdinal("this_is_no_value"));
+    CHECK(enumValues.getValue(1).m_Value == "negative");
+    CHECK(enumValues.getValue(2).m_Name == "No direction");
+    CHECK_THROWS(enumValues.getValue(4));
+  }
+
+  SUBCASE("Copy")
+  {
+    const auto copy = enumValues;
+    CHECK(copy.check("no_direction"));
+    CHECK(copy.getOrdinal("no_direction") == 2);
+    CHECK(copy.getValues().size() == 4);
+  }
 }
@@ -21,6 +21,8 @@
 
 #include <doctest.h>
 
+#include <mutex>
+
 namespace
 {
   void checkBuffer(const std::vector<uint8_t>& buffer)
@@ -39,20 +41,79 @@ TEST_CASE("File resource loader test")
     rexsapi::database::TFileResourceLoader loader{projectDir() / "models"};
 
     std::vector<std::vector<uint8_t>> buffers;
-    loader.load([&buffers](const rexsapi::TResult&, std::vector<uint8_t>& buffer) {
+    loader.load([&buffers](const rexsapi::TResult&, std::vector<uint8_t>& buffer, size_t) {
+      buffers.emplace_back(buffer);
+    });
+
+    CHECK(buffers.size() == 10);
+    std::for_each(buffers.begin(), buffers.end(), [](const auto& buf) {
+      checkBuffer(buf);
+    });
+  }
+
+  SUBCASE("Load existing resources in parallel")
+  {
+    rexsapi::database::TFileResourceLoader loader{projectDir() / "models", rexsapi::database::TLoadMode::PARALLEL};
+
+    std::mutex mutex;
+    std::vector<std::vector<uint8_t>> buffers;
+    auto result = loader.load([&mutex, &buffers](const rexsapi::TResult&, std::vector<uint8_t>& buffer, size_t) {
+      std::scoped_lock lock{mutex};
       buffers.emplace_back(buffer);
     });
 
+    CHECK(result);
     CHECK(buffers.size() == 10);
     std::for_each(buffers.begin(), buffers.end(), [](const auto& buf) {
       checkBuffer(buf);
     });
   }
 
+  SUBCASE("Parallel errors are merged in resource order")
+  {
+    const auto addVersion = [](rexsapi::TResult& res, std::vector<uint8_t>& buffer, size_t) {
+      const std::string content{buffer.begin(), buffer.end()};
+      const auto start = content.find("version=\"") + 9;
+      res.addError(rexsapi::TError{rexsapi::TErrorLevel::ERR, content.substr(start, content.find('"', start) - start)});
+    };
+
+    rexsapi::database::TFileResourceLoader loader{projectDir() / "models", rexsapi::database::TLoadMode::PARALLEL};
+    const auto result = loader.load(addVersion);
+    rexsapi::database::TFileResourceLoader sequentialLoader{projectDir() / "models"};
+    const auto sequentialResult = sequentialLoader.load(addVersion);
+
+    REQUIRE(result.getErrors().size() == 10);
+    REQUIRE(sequentialResult.getErrors().size() == 10);
+    for (size_t n = 0; n < result.getErrors().size(); ++n) {
+      CHECK(result.getErrors()[n].getMessage() == sequentialResult.getErrors()[n].getMessage());
+    }
+  }
+
+  SUBCASE("Resource indices do not depend on the load mode")
+  {
+    const auto collect = [](rexsapi::database::TLoadMode mode) {
+      std::mutex mutex;
+      std::vector<std::vector<uint8_t>> buffers(10);
+      rexsapi::database::TFileResourceLoader loader{projectDir() / "models", mode};
+      loader.load([&mutex, &buffers](const rexsapi::TResult&, std::vector<uint8_t>& buffer, size_t index) {
+        std::scoped_lock lock{mutex};
+        buffers.at(index) = buffer;
+      });
+      return buffers;
+    };
+
+    const auto sequential = collect(rexsapi::database::TLoadMode::SEQUENTIAL);
+    const auto parallel = collect(rexsapi::database::TLoadMode::PARALLEL);
+    for (size_t n = 0; n < sequential.size(); ++n) {
+      CHECK_FALSE(sequential[n].empty());
+      CHECK(parallel[n] == sequential[n]);
+    }
+  }
+
   SUBCASE("Load not existing path")
   {
     rexsapi::database::TFileResourceLoader loader{projectDir() / "non-existing-models"};
-    CHECK_THROWS(loader.load([](const rexsapi::TResult&, std::vector<uint8_t>&) {
+    CHECK_THROWS(loader.load([](const rexsapi::TResult&, std::vector<uint8_t>&, size_t) {
       // nothing to do
     }));
   }
@@ -67,7 +128,7 @@ TEST_CASE("File resource loader test")
   {
     TemporaryDirectory guard{};
     rexsapi::database::TFileResourceLoader loader{guard.getTempDirectoryPath()};
-    auto result = loader.load([](const rexsapi::TResult&, std::vector<uint8_t>&) {
+    auto result = loader.load([](const rexsapi::TResult&, std::vector<uint8_t>&, size_t) {
       // nothing to do
     });
     CHECK_FALSE(result);
@@ -51,4 +51,24 @@ TEST_CASE("Test rexs model registry")
     CHECK_THROWS_WITH((void)registry.getModel(rexsapi::TRexsVersion{"1.99"}, "en"),
                       "cannot find a model for version '1.99' and locale 'en'");
   }
+
+  SUBCASE("Get models of all versions and languages")
+  {
+    for (const auto& version : {"1.0", "1.1", "1.2", "1.3", "1.4"}) {
+      for (const std::string language : {"de", "en"}) {
+        const auto& model = registry.getModel(rexsapi::TRexsVersion{version}, std::string_view{language});
+        CHECK(model.getVersion() == rexsapi::TRexsVersion{version});
+        CHECK(model.getLanguage() == language);
+      }
+    }
+  }
+
+  SUBCASE("Moved registry")
+  {
+    const auto moved = std::move(result.first);
+    const auto& model = moved.getModel(rexsapi::TRexsVersion{"1.4"}, "en");
+    CHECK(model.getLanguage() == "en");
+    CHECK(model.findUnitByName(std::string_view{"mm"}).getId() == 2);
+    CHECK_THROWS_WITH((void)model.findUnitByName("puschel"), "unit 'puschel' not found in database");
+  }
 }
@@ -17,8 +17,10 @@
 #include <rexsapi/database/FileResourceLoader.hxx>
 #include <rexsapi/database/XMLModelLoader.hxx>
 
+#include <test/TemporaryDirectory.hxx>
 #include <test/TestHelper.hxx>
 
+#include <fstream>
 #include <set>
 
 #include <doctest.h>
@@ -34,7 +36,7 @@ namespace
     {
     }
 
-    rexsapi::TResult load(const std::function<void(rexsapi::TResult&, std::vector<uint8_t>&)>& callback) const
+    rexsapi::TResult load(const std::function<void(rexsapi::TResult&, std::vector<uint8_t>&, size_t)>& callback) const
     {
       if (!callback) {
         throw rexsapi::TException{"callback not set for resource loader"};
@@ -42,7 +44,7 @@ namespace
 
       rexsapi::TResult result;
       std::vector<uint8_t> buf{m_Buffer.begin(), m_Buffer.end()};
-      callback(result, buf);
+      callback(result, buf, 0);
 
       return result;
     }
@@ -87,6 +89,63 @@ TEST_CASE("XML model loader test")
     CHECK(attribute.getInterval()->check(0));
   }
 
+  SUBCASE("Load existing models in parallel")
+  {
+    rexsapi::database::TFileResourceLoader loader{projectDir() / "models"};
+    rexsapi::database::TXmlModelLoader modelLoader{loader, schemaLoader};
+    auto result = modelLoader.load([&models](rexsapi::database::TModel model) {
+      models.emplace_back(std::move(model));
+    });
+    CHECK(result);
+
+    rexsapi::database::TFileResourceLoader parallelLoader{projectDir() / "models",
+                                                          rexsapi::database::TLoadMode::PARALLEL};
+    rexsapi::database::TXmlModelLoader parallelModelLoader{parallelLoader, schemaLoader};
+    std::vector<rexsapi::database::TModel> parallelModels;
+    result = parallelModelLoader.load([&parallelModels](rexsapi::database::TModel model) {
+      parallelModels.emplace_back(std::move(model));
+    });
+    CHECK(result);
+
+    REQUIRE(models.size() == 10);
+    REQUIRE(parallelModels.size() == models.size());
+    for (size_t n = 0; n < models.size(); ++n) {
+      CHECK(parallelModels[n].getVersion() == models[n].getVersion());
+      CHECK(parallelModels[n].getLanguage() == models[n].getLanguage());
+      CHECK(parallelModels[n].getDate() == models[n].getDate());
+    }
+  }
+
+  SUBCASE("Duplicate models are passed on in resource order")
+  {
+    TemporaryDirectory guard{};
+    std::string content;
+    {
+      std::ifstream stream{projectDir() / "models" / "rexs_model_1.4_en.xml", std::ios::binary};
+      content.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+    }
+    const std::string gearUnit{"name=\"Gear unit\""};
+    const auto pos = content.find(gearUnit);
+    REQUIRE(pos != std::string::npos);
+    for (const auto& name : {"a", "b", "c", "d"}) {
+      auto duplicate = content;
+      duplicate.replace(pos, gearUnit.size(), fmt::format("name=\"Gear unit {}\"", name));
+      std::ofstream{guard.getTempDirectoryPath() / fmt::format("rexs_model_{}.xml", name), std::ios::binary}
+        << duplicate;
+    }
+
+    rexsapi::database::TFileResourceLoader loader{guard.getTempDirectoryPath(), rexsapi::database::TLoadMode::PARALLEL};
+    rexsapi::database::TXmlModelLoader modelLoader{loader, schemaLoader};
+    for (size_t run = 0; run < 5; ++run) {
+      std::vector<std::string> names;
+      const auto result = modelLoader.load([&names](rexsapi::database::TModel model) {
+        names.emplace_back(model.findComponentById("gear_unit").getName());
+      });
+      CHECK(result);
+      CHECK(names == std::vector<std::string>{"Gear unit a", "Gear unit b", "Gear unit c", "Gear unit d"});
+    }
+  }
+
   SUBCASE("Load broken XML")
   {
     const auto* s =
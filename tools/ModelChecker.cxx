@@ -15,17 +15,23 @@
  */
 
 #define REXSAPI_MINIZ_IMPL
+#define REXSAPI_ALLOCATION_COUNTER_IMPL
 #include <rexsapi/Rexsapi.hxx>
 
 #include "Cli11.hxx"
 #include "ToolsHelper.hxx"
 
+#include <fstream>
+
 
 struct Options {
   rexsapi::TMode mode{rexsapi::TMode::STRICT_MODE};
   std::filesystem::path modelDatabasePath;
   std::vector<std::filesystem::path> models;
   bool showWarnings{false};
+  bool showStatistics{false};
+  bool showMemoryStatistics{false};
+  std::filesystem::path statisticsFile;
 };
 
 static std::string getVersion()
@@ -55,6 +61,10 @@ static std::optional<Options> getOptions(int argc, char** argv)
     ->excludes(strictFlag);
   app.add_flag("-w,--warnings", options.showWarnings, "Show all warnings");
   app.add_flag("-r", recurse, "Recurse into sub-directories");
+  app.add_flag("--stats", options.showStatistics, "Show the time, bytes and elements of each load phase");
+  app.add_flag("--memstats", options.showMemoryStatistics,
+               "Show the allocations, allocated bytes and peak live bytes of each load phase");
+  app.add_option("--stats-json", options.statisticsFile, "Write the load statistics of all models as json to a file");
   app.add_option("-d,--database", options.modelDatabasePath, "The model database path")
     ->check(CLI::ExistingDirectory)
     ->required();
@@ -77,6 +87,63 @@ static std::optional<Options> getOptions(int argc, char** argv)
   return options;
 }
 
+static double toMicroseconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+static void printStatistics(const rexsapi::TLoadStatistics& statistics)
+{
+  std::cout << fmt::format("  {:<20}{:>14}{:>14}{:>12}", "phase", "time [us]", "bytes", "elements") << std::endl;
+  for (const auto& phase : statistics.getPhases()) {
+    std::cout << fmt::format("  {:<20}{:>14.1f}{:>14}{:>12}", rexsapi::toLoadPhaseString(phase.m_Phase),
+                             toMicroseconds(phase.m_Duration), phase.m_Bytes, phase.m_Elements)
+              << std::endl;
+  }
+  std::cout << fmt::format("  {:<20}{:>14.1f}", "total", toMicroseconds(statistics.getDuration())) << std::endl;
+}
+
+static void printMemoryStatistics(const rexsapi::TLoadStatistics& statistics,
+                                  const rexsapi::TAllocationStatistics& load)
+{
+  std::cout << fmt::format("  {:<20}{:>14}{:>16}{:>16}", "phase", "allocations", "allocated", "peak") << std::endl;
+  for (const auto& phase : statistics.getPhases()) {
+    std::cout << fmt::format("  {:<20}{:>14}{:>16}{:>16}", rexsapi::toLoadPhaseString(phase.m_Phase),
+                             phase.m_Memory.m_Allocations, phase.m_Memory.m_Bytes, phase.m_Memory.m_PeakBytes)
+              << std::endl;
+  }
+  std::cout << fmt::format("  {:<20}{:>14}{:>16}{:>16}", "load", load.m_Allocations, load.m_Bytes, load.m_PeakBytes)
+            << std::endl;
+}
+
+static rexsapi::json toJson(const rexsapi::TAllocationStatistics& memory)
+{
+  return rexsapi::json{
+    {"allocations", memory.m_Allocations}, {"allocated_bytes", memory.m_Bytes}, {"peak_bytes", memory.m_PeakBytes}};
+}
+
+static rexsapi::json toJson(const std::filesystem::path& modelFile, const rexsapi::TLoadStatistics& statistics,
+                            const std::optional<rexsapi::TAllocationStatistics>& load)
+{
+  rexsapi::json phases = rexsapi::json::array();
+  for (const auto& phase : statistics.getPhases()) {
+    rexsapi::json entry{{"phase", rexsapi::toLoadPhaseString(phase.m_Phase)},
+                        {"duration_us", toMicroseconds(phase.m_Duration)},
+                        {"bytes", phase.m_Bytes},
+                        {"elements", phase.m_Elements}};
+    if (load) {
+      entry["memory"] = toJson(phase.m_Memory);
+    }
+    phases.push_back(std::move(entry));
+  }
+  rexsapi::json result{
+    {"file", modelFile.string()}, {"phases", phases}, {"duration_us", toMicroseconds(statistics.getDuration())}};
+  if (load) {
+    result["memory"] = toJson(*load);
+  }
+  return result;
+}
+
 
 int main(int argc, char** argv)
 {
@@ -87,6 +154,10 @@ int main(int argc, char** argv)
     }
 
     const rexsapi::TModelLoader loader{options->modelDatabasePath};
+    const bool collectStatistics =
+      options->showStatistics || options->showMemoryStatistics || !options->statisticsFile.empty();
+    rexsapi::TAllocationCounter::enable(options->showMemoryStatistics);
+    rexsapi::json statisticsJson = rexsapi::json::array();
 
     bool start{true};
     for (const auto& modelFile : options->models) {
@@ -96,7 +167,14 @@ int main(int argc, char** argv)
         std::cout << std::endl;
       }
       rexsapi::TResult result;
-      const auto model = loader.load(modelFile, result, options->mode);
+      rexsapi::TLoadStatistics statistics;
+      std::optional<rexsapi::TAllocationStatistics> memory;
+      rexsapi::TLoadOptions loadOptions;
+      loadOptions.m_Statistics = collectStatistics ? &statistics : nullptr;
+      const auto model = loader.load(modelFile, result, options->mode, loadOptions);
+      if (rexsapi::TAllocationCounter::isEnabled()) {
+        memory = statistics.getMemory();
+      }
 
       std::cout << "File " << modelFile;
       if (!result) {
@@ -118,6 +196,20 @@ int main(int argc, char** argv)
         }
         std::cout << "  " << error.getMessage() << std::endl;
       }
+      if (options->showStatistics) {
+        printStatistics(statistics);
+      }
+      if (memory) {
+        printMemoryStatistics(statistics, *memory);
+      }
+      if (!options->statisticsFile.empty()) {
+        statisticsJson.push_back(toJson(modelFile, statistics, memory));
+      }
+    }
+
+    if (!options->statisticsFile.empty()) {
+      std::ofstream stream{options->statisticsFile};
+      stream << statisticsJson.dump(2) << std::endl;
     }
   } catch (const std::exception& ex) {
     std::cerr << "Exception caught: " << ex.what() << std::endl;
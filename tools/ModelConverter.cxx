@@ -62,7 +62,7 @@ static std::optional<Options> getOptions(int argc, char** argv)
         options.type = rexsapi::fileTypeFromString(value);
       },
       "Select output format")
-    ->check(CLI::IsMember({"xml", "json"}))
+    ->check(CLI::IsMember({"xml", "json", "binary"}))
     ->required();
   app.add_option("-d,--database", options.modelDatabasePath, "The model database path")
     ->check(CLI::ExistingDirectory)
@@ -135,6 +135,10 @@ int main(int argc, char** argv)
             rexsapi::TModelSaver{}.store(result, *model, options->outputPath / file.replace_extension(".rexs"),
                                          rexsapi::TSaveType::XML);
             break;
+          case rexsapi::TFileType::BINARY:
+            rexsapi::TModelSaver{}.store(result, *model, options->outputPath / file.replace_extension(".rexsb"),
+                                         rexsapi::TSaveType::BINARY);
+            break;
           default:
             throw rexsapi::TException{fmt::format("Format is not implemented ({})", file.extension().string())};
         }
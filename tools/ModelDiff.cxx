@@ -0,0 +1,191 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define REXSAPI_MINIZ_IMPL
+#include <rexsapi/ModelDiff.hxx>
+#include <rexsapi/Rexsapi.hxx>
+
+#include "Cli11.hxx"
+
+
+struct Options {
+  rexsapi::TMode mode{rexsapi::TMode::STRICT_MODE};
+  std::filesystem::path modelDatabasePath;
+  std::filesystem::path oldModel;
+  std::filesystem::path newModel;
+  double absoluteTolerance{0.0};
+  double relativeTolerance{0.0};
+  std::string keyAttribute;
+};
+
+static std::string getVersion()
+{
+  return fmt::format("model_diff version {}\n", REXSAPI_VERSION_STRING);
+}
+
+static std::optional<Options> getOptions(int argc, char** argv)
+{
+  Options options;
+
+  CLI::App app{getVersion()};
+  auto* strictFlag = app.add_flag(
+    "--mode-strict",
+    [&options](auto) {
+      options.mode = rexsapi::TMode::STRICT_MODE;
+    },
+    "Strict standard handling");
+  app
+    .add_flag(
+      "--mode-relaxed",
+      [&options](auto) {
+        options.mode = rexsapi::TMode::RELAXED_MODE;
+      },
+      "Relaxed standard handling")
+    ->excludes(strictFlag);
+  app.add_option("-t,--tolerance", options.absoluteTolerance, "Absolute tolerance for floating point values")
+    ->check(CLI::NonNegativeNumber);
+  app.add_option("--relative-tolerance", options.relativeTolerance, "Relative tolerance for floating point values")
+    ->check(CLI::NonNegativeNumber);
+  app.add_option("-k,--key-attribute", options.keyAttribute,
+                 "Match components by type and the value of this attribute instead of type and name");
+  app.add_option("-d,--database", options.modelDatabasePath, "The model database path")
+    ->check(CLI::ExistingDirectory)
+    ->required();
+  app.add_option("old", options.oldModel, "The old model file")->check(CLI::ExistingFile)->required();
+  app.add_option("new", options.newModel, "The new model file")->check(CLI::ExistingFile)->required();
+
+  try {
+    app.parse(argc, argv);
+  } catch (const CLI::Success& e) {
+    app.exit(e);
+    return {};
+  } catch (const CLI::ParseError& e) {
+    std::cerr << getVersion() << std::endl;
+    app.exit(e);
+    return {};
+  }
+
+  return options;
+}
+
+static std::optional<rexsapi::TModel> loadModel(const rexsapi::TModelLoader& loader, const Options& options,
+                                                const std::filesystem::path& modelFile)
+{
+  rexsapi::TResult result;
+  auto model = loader.load(modelFile, result, options.mode);
+  if (!model) {
+    std::cerr << "Error: could not load model " << modelFile << std::endl;
+    for (const auto& issue : result.getErrors()) {
+      std::cerr << "  " << issue.getMessage() << std::endl;
+    }
+  }
+  return model;
+}
+
+static std::string toValueString(const rexsapi::TAttribute* attribute)
+{
+  if (attribute == nullptr) {
+    return "";
+  }
+  if (!attribute->hasValue()) {
+    return "(empty)";
+  }
+  switch (attribute->getValueType()) {
+    case rexsapi::TValueType::FLOATING_POINT:
+    case rexsapi::TValueType::BOOLEAN:
+    case rexsapi::TValueType::INTEGER:
+    case rexsapi::TValueType::ENUM:
+    case rexsapi::TValueType::STRING:
+    case rexsapi::TValueType::FILE_REFERENCE:
+    case rexsapi::TValueType::REFERENCE_COMPONENT:
+      return fmt::format("{} [{}]", attribute->getValueAsString(), attribute->getUnit().getName());
+    default:
+      return fmt::format("({}) [{}]", rexsapi::toTypeString(attribute->getValueType()),
+                         attribute->getUnit().getName());
+  }
+}
+
+static void printDiff(const rexsapi::TModelDiff& diff)
+{
+  for (const auto& component : diff.getComponents()) {
+    std::cout << fmt::format("component {} {}", component.m_Key, rexsapi::toDiffTypeString(component.m_Type))
+              << std::endl;
+    for (const auto& attribute : component.m_Attributes) {
+      switch (attribute.m_Type) {
+        case rexsapi::TDiffType::ADDED:
+          std::cout << fmt::format("  + {}: {}", attribute.getAttributeId(), toValueString(attribute.m_New));
+          break;
+        case rexsapi::TDiffType::REMOVED:
+          std::cout << fmt::format("  - {}: {}", attribute.getAttributeId(), toValueString(attribute.m_Old));
+          break;
+        case rexsapi::TDiffType::CHANGED:
+          std::cout << fmt::format("  ~ {}: {} -> {}", attribute.getAttributeId(), toValueString(attribute.m_Old),
+                                   toValueString(attribute.m_New));
+          break;
+      }
+      std::cout << std::endl;
+    }
+  }
+  for (const auto& relation : diff.getRelations()) {
+    std::cout << fmt::format("relation {} {}", relation.m_Key, rexsapi::toDiffTypeString(relation.m_Type))
+              << std::endl;
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  try {
+    auto options = getOptions(argc, argv);
+    if (!options) {
+      return 2;
+    }
+
+    const rexsapi::TModelLoader loader{options->modelDatabasePath};
+    const auto oldModel = loadModel(loader, *options, options->oldModel);
+    const auto newModel = loadModel(loader, *options, options->newModel);
+    if (!oldModel || !newModel) {
+      return 2;
+    }
+
+    rexsapi::TModelDiffOptions diffOptions;
+    diffOptions.m_AbsoluteTolerance = options->absoluteTolerance;
+    diffOptions.m_RelativeTolerance = options->relativeTolerance;
+    if (!options->keyAttribute.empty()) {
+      diffOptions.m_Key = [&keyAttribute = options->keyAttribute](const rexsapi::TComponent& component) {
+        const auto* attribute = component.findAttribute(keyAttribute);
+        if (attribute == nullptr || !attribute->hasValue()) {
+          return fmt::format("{}/{}", component.getType(), component.getName());
+        }
+        return fmt::format("{}:{}", component.getType(), attribute->getValueAsString());
+      };
+    }
+
+    const rexsapi::TModelDiff diff{*oldModel, *newModel, std::move(diffOptions)};
+    printDiff(diff);
+    if (!diff.empty()) {
+      std::cout << fmt::format("{} component and {} relation differences", diff.getComponents().size(),
+                               diff.getRelations().size())
+                << std::endl;
+      return 1;
+    }
+  } catch (const std::exception& ex) {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return 2;
+  }
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define REXSAPI_MINIZ_IMPL
+#include <rexsapi/ModelGenerator.hxx>
+#include <rexsapi/Rexsapi.hxx>
+
+#include "Cli11.hxx"
+
+
+struct Options {
+  std::filesystem::path modelDatabasePath;
+  std::filesystem::path output;
+  rexsapi::TSaveType type{rexsapi::TSaveType::XML};
+  std::string version{"1.4"};
+  std::string language{"en"};
+  rexsapi::TModelGeneratorOptions generator;
+};
+
+static std::string getVersion()
+{
+  return fmt::format("model_generator version {}\n", REXSAPI_VERSION_STRING);
+}
+
+static std::optional<Options> getOptions(int argc, char** argv)
+{
+  Options options;
+
+  CLI::App app{getVersion()};
+  app
+    .add_option_function<std::string>(
+      "-f,--format",
+      [&options](const std::string& value) {
+        if (value == "json") {
+          options.type = rexsapi::TSaveType::JSON;
+        } else if (value == "zip") {
+          options.type = rexsapi::TSaveType::COMPRESSED_XML;
+        } else {
+          options.type = rexsapi::TSaveType::XML;
+        }
+      },
+      "Select output format")
+    ->check(CLI::IsMember({"xml", "json", "zip"}));
+  app.add_option("-d,--database", options.modelDatabasePath, "The model database path")
+    ->check(CLI::ExistingDirectory)
+    ->required();
+  app.add_option("-o,--output", options.output, "The model file to generate")->required();
+  app.add_option("--rexs-version", options.version, "The REXS version of the model");
+  app.add_option("--language", options.language, "The language of the model")->check(CLI::IsMember({"de", "en"}));
+  app.add_option("-c,--components", options.generator.m_Components, "Number of components")
+    ->check(CLI::PositiveNumber);
+  app.add_option("-a,--attributes", options.generator.m_AttributesPerComponent, "Number of attributes per component");
+  app.add_option("--relations", options.generator.m_Relations, "Minimum number of relations");
+  app.add_option("--array-size", options.generator.m_ArraySize, "Number of array elements");
+  app.add_option("--matrix-size", options.generator.m_MatrixSize, "Number of matrix rows and columns");
+  app
+    .add_option_function<std::string>(
+      "--coded",
+      [&options](const std::string& value) {
+        if (value == "default") {
+          options.generator.m_CodeType = rexsapi::TCodeType::Default;
+        } else if (value == "optimized") {
+          options.generator.m_CodeType = rexsapi::TCodeType::Optimized;
+        } else {
+          options.generator.m_CodeType = rexsapi::TCodeType::None;
+        }
+      },
+      "Code numeric arrays and matrices")
+    ->check(CLI::IsMember({"none", "default", "optimized"}));
+  app.add_option("-l,--load-cases", options.generator.m_LoadCases, "Number of load cases");
+  app.add_option("-s,--seed", options.generator.m_Seed, "Seed for the generated values");
+  app.add_option("--component-types", options.generator.m_ComponentTypes, "Component types to generate");
+
+  try {
+    app.parse(argc, argv);
+  } catch (const CLI::Success& e) {
+    app.exit(e);
+    return {};
+  } catch (const CLI::ParseError& e) {
+    std::cerr << getVersion() << std::endl;
+    app.exit(e);
+    return {};
+  }
+
+  return options;
+}
+
+static rexsapi::database::TModelRegistry createModelRegistry(const std::filesystem::path& path)
+{
+  rexsapi::xml::TFileXsdSchemaLoader schemaLoader{path / "rexs-dbmodel.xsd"};
+  rexsapi::database::TFileResourceLoader resourceLoader{path, rexsapi::database::TLoadMode::PARALLEL};
+  rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+  return rexsapi::database::TModelRegistry::createModelRegistry(modelLoader).first;
+}
+
+
+int main(int argc, char** argv)
+{
+  try {
+    auto options = getOptions(argc, argv);
+    if (!options) {
+      return EXIT_FAILURE;
+    }
+
+    const auto registry = createModelRegistry(options->modelDatabasePath);
+    const auto& databaseModel = registry.getModel(rexsapi::TRexsVersion{options->version}, options->language);
+    const rexsapi::TModelGenerator generator{databaseModel, options->generator};
+    const auto model = generator.generate();
+
+    size_t attributes{0};
+    for (const auto& component : model.getComponents()) {
+      attributes += component.getAttributes().size();
+    }
+
+    rexsapi::TResult result;
+    rexsapi::TModelSaver{}.store(result, model, options->output, options->type);
+    if (!result) {
+      std::cerr << fmt::format("Could not store model to {}: {}", options->output.string(),
+                               result.getErrors()[0].getMessage())
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << fmt::format("Generated model with {} components, {} attributes, {} relations and {} load cases",
+                             model.getComponents().size(), attributes, model.getRelations().size(),
+                             model.getLoadSpectrum().getLoadCases().size())
+              << std::endl;
+  } catch (const std::exception& ex) {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}